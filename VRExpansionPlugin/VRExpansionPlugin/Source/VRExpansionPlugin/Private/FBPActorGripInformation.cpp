@@ -10,6 +10,7 @@
 void FBPActorGripInformation::ClearNonReppingItems()
 {
 	ValueCache         = FGripValueCache();
+	DispatchCache      = FGripDispatchCache();
 	bColliding         = false;
 	bIsLocked          = false;
 	LastLockedRotation = FQuat::Identity;
@@ -17,6 +18,10 @@ void FBPActorGripInformation::ClearNonReppingItems()
 	LastWorldTransform.SetIdentity();
 	
 	bSkipNextConstraintLengthCheck = false               ;
+	bHasBatchedWorldTransform      = false               ;
+	bHasLastSweptTransform         = false               ;
+	bHasLODRelativeTransform       = false               ;
+	LODTimeSinceUpdate             = 0.0f                ;
 	bIsPaused                      = false               ;
 	AdditionTransform              = FTransform::Identity;
 	GripDistance                   = 0.0f                ;
@@ -0,0 +1,184 @@
+// Parent Header
+#include "FPhysicsGripHandlePool.h"
+
+// VREP
+#include "GripMotionControllerComponent.h"
+#include "VRGlobalSettings.h"
+
+#if WITH_PHYSX
+#include "PhysXSupport.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Physics Handle Pool Hits"), STAT_PhysicsHandlePoolHits, STATGROUP_TickGrip);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Physics Handle Pool Misses"), STAT_PhysicsHandlePoolMisses, STATGROUP_TickGrip);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Physics Handles In Use"), STAT_PhysicsHandlesInUse, STATGROUP_TickGrip);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Physics Handles Peak In Use"), STAT_PhysicsHandlesPeakInUse, STATGROUP_TickGrip);
+
+TMap<PxScene*, TArray<FPhysicsGripHandlePool::FPooledHandle>> FPhysicsGripHandlePool::ScenePools;
+FDelegateHandle FPhysicsGripHandlePool::OnPhysSceneTermHandle;
+int32 FPhysicsGripHandlePool::NumHandlesInUse = 0;
+int32 FPhysicsGripHandlePool::PeakHandlesInUse = 0;
+PxConstraintFlags FPhysicsGripHandlePool::DefaultConstraintFlags;
+
+
+// Public
+
+// Functions
+
+void FPhysicsGripHandlePool::AcquireHandle(PxScene* Scene, const PxTransform& KinPose, PxRigidDynamic* TargetActor, const PxTransform& TargetLocalPose, PxRigidDynamic*& OutKinActor, PxD6Joint*& OutJoint)
+{
+	check(IsInGameThread());
+
+	++NumHandlesInUse;
+	PeakHandlesInUse = FMath::Max(PeakHandlesInUse, NumHandlesInUse);
+	SET_DWORD_STAT(STAT_PhysicsHandlesInUse, NumHandlesInUse);
+	SET_DWORD_STAT(STAT_PhysicsHandlesPeakInUse, PeakHandlesInUse);
+
+	TArray<FPooledHandle> * Pool = ScenePools.Find(Scene);
+
+	if (Pool && Pool->Num() > 0)
+	{
+		INC_DWORD_STAT(STAT_PhysicsHandlePoolHits);
+
+		FPooledHandle Handle = Pool->Pop(false);
+
+		// Already in the scene, just move it and point the joint at the new object
+		Handle.KinActor->setGlobalPose(KinPose);
+
+		Handle.Joint->setActors(Handle.KinActor, TargetActor);
+		Handle.Joint->setLocalPose(PxJointActorIndex::eACTOR0, PxTransform(PxIdentity));
+		Handle.Joint->setLocalPose(PxJointActorIndex::eACTOR1, TargetLocalPose);
+		ResetJoint(Handle.Joint);
+
+		OutKinActor = Handle.KinActor;
+		OutJoint = Handle.Joint;
+		return;
+	}
+
+	INC_DWORD_STAT(STAT_PhysicsHandlePoolMisses);
+
+	// Create kinematic actor we are going to create joint with. This will be moved around with calls to SetLocation/SetRotation.
+	PxRigidDynamic* KinActor = Scene->getPhysics().createRigidDynamic(KinPose);
+	KinActor->setRigidBodyFlag(PxRigidBodyFlag::eKINEMATIC, true);
+
+	KinActor->setMass(0.0f); // 1.0f;
+	KinActor->setMassSpaceInertiaTensor(PxVec3(0.0f, 0.0f, 0.0f));// PxVec3(1.0f, 1.0f, 1.0f));
+	KinActor->setMaxDepenetrationVelocity(PX_MAX_F32);
+
+	// No bodyinstance
+	KinActor->userData = NULL;
+
+	// Add to Scene
+	Scene->addActor(*KinActor);
+
+	OutJoint = PxD6JointCreate(Scene->getPhysics(), KinActor, PxTransform(PxIdentity), TargetActor, TargetLocalPose);
+
+	if (!OutJoint)
+	{
+		// Nothing to hand back later without a joint, undo the acquire here
+		KinActor->release();
+		OutKinActor = nullptr;
+
+		NumHandlesInUse = FMath::Max(NumHandlesInUse - 1, 0);
+		SET_DWORD_STAT(STAT_PhysicsHandlesInUse, NumHandlesInUse);
+		return;
+	}
+
+	OutKinActor = KinActor;
+
+	// Every pooled joint was created here first, so this is always set before a reset needs it
+	DefaultConstraintFlags = OutJoint->getConstraintFlags();
+
+	// Bind to the scene teardown once so that pooled actors don't outlive their scene
+	if (!OnPhysSceneTermHandle.IsValid())
+	{
+		OnPhysSceneTermHandle = FPhysicsDelegates::OnPhysSceneTerm.AddStatic(&FPhysicsGripHandlePool::OnPhysSceneTerm);
+	}
+}
+
+void FPhysicsGripHandlePool::ReleaseHandle(PxScene* Scene, PxRigidDynamic* KinActor, PxD6Joint* Joint)
+{
+	check(IsInGameThread());
+
+	NumHandlesInUse = FMath::Max(NumHandlesInUse - 1, 0);
+	SET_DWORD_STAT(STAT_PhysicsHandlesInUse, NumHandlesInUse);
+
+	const int32 MaxPooledHandles = GetDefault<UVRGlobalSettings>()->MaxPooledPhysicsHandles;
+
+	// A broken joint can't be repaired, only pool the ones that are still intact
+	if (Scene && KinActor && Joint && MaxPooledHandles > 0 && !(Joint->getConstraintFlags() & PxConstraintFlag::eBROKEN))
+	{
+		TArray<FPooledHandle> & Pool = ScenePools.FindOrAdd(Scene);
+
+		if (Pool.Num() < MaxPooledHandles)
+		{
+			// Detach from the dropped object, a joint between a kinematic actor and the world has no dynamic body and is skipped by the solver
+			Joint->setActors(KinActor, NULL);
+
+			FPooledHandle Handle;
+			Handle.KinActor = KinActor;
+			Handle.Joint = Joint;
+			Pool.Add(Handle);
+			return;
+		}
+	}
+
+	// Destroy joint.
+	if (Joint)
+		Joint->release();
+
+	// Destroy temporary actor.
+	if (KinActor)
+		KinActor->release();
+}
+
+
+// Private
+
+void FPhysicsGripHandlePool::ResetJoint(PxD6Joint* Joint)
+{
+	// Back to the PxD6Joint defaults, SetUpPhysicsHandle only sets what it needs for the grip type
+	Joint->setMotion(PxD6Axis::eX, PxD6Motion::eLOCKED);
+	Joint->setMotion(PxD6Axis::eY, PxD6Motion::eLOCKED);
+	Joint->setMotion(PxD6Axis::eZ, PxD6Motion::eLOCKED);
+	Joint->setMotion(PxD6Axis::eTWIST, PxD6Motion::eLOCKED);
+	Joint->setMotion(PxD6Axis::eSWING1, PxD6Motion::eLOCKED);
+	Joint->setMotion(PxD6Axis::eSWING2, PxD6Motion::eLOCKED);
+
+	const PxD6JointDrive DefaultDrive;
+	Joint->setDrive(PxD6Drive::eX, DefaultDrive);
+	Joint->setDrive(PxD6Drive::eY, DefaultDrive);
+	Joint->setDrive(PxD6Drive::eZ, DefaultDrive);
+	Joint->setDrive(PxD6Drive::eSWING, DefaultDrive);
+	Joint->setDrive(PxD6Drive::eTWIST, DefaultDrive);
+	Joint->setDrive(PxD6Drive::eSLERP, DefaultDrive);
+
+	Joint->setDrivePosition(PxTransform(PxIdentity));
+	Joint->setDriveVelocity(PxVec3(0.0f), PxVec3(0.0f));
+
+	// The previous owner may have changed these through the public HandleData
+	Joint->setBreakForce(PX_MAX_REAL, PX_MAX_REAL);
+	Joint->setConstraintFlags(DefaultConstraintFlags);
+}
+
+void FPhysicsGripHandlePool::OnPhysSceneTerm(FPhysScene* PhysScene)
+{
+	PxScene* Scene = PhysScene ? PhysScene->GetPxScene() : nullptr;
+	TArray<FPooledHandle> * Pool = Scene ? ScenePools.Find(Scene) : nullptr;
+
+	if (!Pool)
+		return;
+
+	{
+		SCOPED_SCENE_WRITE_LOCK(Scene);
+
+		for (FPooledHandle & Handle : *Pool)
+		{
+			Handle.Joint->release();
+			Handle.KinActor->release();
+		}
+	}
+
+	ScenePools.Remove(Scene);
+}
+
+#endif // WITH_PHYSX
@@ -0,0 +1,47 @@
+#pragma once
+
+// Unreal
+#include "CoreMinimal.h"
+#include "PhysicsPublic.h"
+
+#if WITH_PHYSX
+#include "PhysXPublic.h"
+
+
+
+/**
+* Per physics scene pool of the kinematic actors and D6 joints that physics grips use as their handle.
+* Re-grabbing re-targets and resets a pooled pair instead of inserting and removing actors from the scene.
+* Pool size per scene is capped by UVRGlobalSettings::MaxPooledPhysicsHandles, 0 disables pooling.
+* Game thread only, callers are expected to already hold the scenes write lock.
+*/
+class FPhysicsGripHandlePool
+{
+public:
+
+	// Returns a kinematic actor at KinPose in Scene and a joint from it to TargetActor, the joint is reset to the D6 defaults
+	// Both are null if the joint failed to create, nothing needs to be handed back through ReleaseHandle then
+	static void AcquireHandle(physx::PxScene* Scene, const physx::PxTransform& KinPose, physx::PxRigidDynamic* TargetActor, const physx::PxTransform& TargetLocalPose, physx::PxRigidDynamic*& OutKinActor, physx::PxD6Joint*& OutJoint);
+
+	// Returns the handle to the scenes pool, or releases it if the pool is full
+	static void ReleaseHandle(physx::PxScene* Scene, physx::PxRigidDynamic* KinActor, physx::PxD6Joint* Joint);
+
+private:
+
+	struct FPooledHandle
+	{
+		physx::PxRigidDynamic* KinActor;
+		physx::PxD6Joint*      Joint   ;
+	};
+
+	static void ResetJoint(physx::PxD6Joint* Joint);
+	static void OnPhysSceneTerm(FPhysScene* PhysScene);
+
+	static TMap<physx::PxScene*, TArray<FPooledHandle>> ScenePools;
+	static FDelegateHandle OnPhysSceneTermHandle;
+	static int32 NumHandlesInUse;
+	static int32 PeakHandlesInUse;
+	static physx::PxConstraintFlags DefaultConstraintFlags; // Flags of a freshly created joint, restored by ResetJoint
+};
+
+#endif // WITH_PHYSX
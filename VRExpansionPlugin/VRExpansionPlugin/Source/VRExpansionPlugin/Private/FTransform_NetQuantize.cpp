@@ -32,6 +32,11 @@ namespace VRDataTypeCVARs
 
 // Functions
 
+bool FTransform_NetQuantize::IsHighPrecisionEnabled()
+{
+	return VRDataTypeCVARs::RepHighPrecisionTransforms > 0;
+}
+
 bool FTransform_NetQuantize::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
 {
 	bOutSuccess = true;
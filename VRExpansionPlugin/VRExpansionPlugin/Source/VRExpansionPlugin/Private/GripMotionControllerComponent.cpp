@@ -18,8 +18,10 @@
 #include "DrawDebugHelpers.h"
 #include "TimerManager.h"
 #include "VRBaseCharacter.h"
+#include "GameFramework/PlayerController.h"
 
 #include "GripScripts/GS_Default.h"
+#include "Misc/GripTickSubsystem.h"
 
 #include "PhysicsPublic.h"
 #include "PhysicsEngine/BodySetup.h"
@@ -27,6 +29,7 @@
 #if WITH_PHYSX
 #include "PhysXSupport.h"
 #include "PhysicsReplication.h"
+#include "FPhysicsGripHandlePool.h"
 #endif // WITH_PHYSX
 
 //#if ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION <= 11
@@ -38,6 +41,11 @@ DEFINE_LOG_CATEGORY(LogVRMotionController);
 //For UE4 Profiler ~ Stat
 DECLARE_CYCLE_STAT(TEXT("TickGrip ~ TickingGrip"), STAT_TickGrip, STATGROUP_TickGrip);
 DECLARE_CYCLE_STAT(TEXT("GetGripWorldTransform ~ GettingTransform"), STAT_GetGripTransform, STATGROUP_TickGrip);
+DEFINE_STAT(STAT_GripIndexRebuilds);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Grip Sweeps Issued"), STAT_GripSweepsIssued, STATGROUP_TickGrip);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Grip Sweeps Skipped"), STAT_GripSweepsSkipped, STATGROUP_TickGrip);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Late Update Hierarchy Rebuilds"), STAT_LateUpdateHierarchyRebuilds, STATGROUP_TickGrip);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Grip LOD Reduced Updates"), STAT_GripLODReducedUpdates, STATGROUP_TickGrip);
 
 // MAGIC NUMBERS
 // Constraint multipliers for angular, to avoid having to have two sets of stiffness/damping variables
@@ -64,6 +72,79 @@ namespace GripMotionControllerCvars
 		TEXT("When on, will draw debug speheres for physics grips COM.\n")
 		TEXT("0: Disable, 1: Enable"),
 		ECVF_Default);
+
+	static int32 BatchGripTransforms = 0;
+	FAutoConsoleVariableRef CVarBatchGripTransforms(
+		TEXT("vr.BatchGripTransforms"),
+		BatchGripTransforms,
+		TEXT("When on, controllers that begin play will have their grips ticked by the UGripTickSubsystem.\n")
+		TEXT("Default grip transforms for every controller in the world are then computed in a single pass.\n")
+		TEXT("0: Disable, 1: Enable"),
+		ECVF_Default);
+
+	static float GripSweepSkipDistance = 0.025f;
+	FAutoConsoleVariableRef CVarGripSweepSkipDistance(
+		TEXT("vr.GripSweepSkipDistance"),
+		GripSweepSkipDistance,
+		TEXT("InteractiveCollisionWithSweep and InteractiveHybridCollisionWithSweep grips that are not colliding skip their sweep while their target is within this many cm of the last unblocked sweep.\n")
+		TEXT("SweepWithPhysics grips always sweep, their sweeps are only there for the hit events.\n")
+		TEXT("<= 0: Always sweep"),
+		ECVF_Default);
+
+	static float GripSweepSkipAngle = 0.1f;
+	FAutoConsoleVariableRef CVarGripSweepSkipAngle(
+		TEXT("vr.GripSweepSkipAngle"),
+		GripSweepSkipAngle,
+		TEXT("Rotation tolerance in degrees for vr.GripSweepSkipDistance."),
+		ECVF_Default);
+}
+
+namespace GripDispatchCacheStatics
+{
+	// False if the event is overridden in blueprint
+	static bool IsNativeEvent(const UObject * Object, FName EventName)
+	{
+		const UFunction * Function = Object->FindFunction(EventName);
+		return !Function || Function->HasAnyFunctionFlags(FUNC_Native);
+	}
+}
+
+// Player viewpoints for the grip LOD distance check, gathered once per frame instead of once per controller
+namespace GripLODViewpoints
+{
+	struct FViewpoint
+	{
+		const AController * Controller;
+		FVector Location;
+	};
+
+	static TWeakObjectPtr<UWorld> CachedWorld;
+	static uint64 CachedFrame = MAX_uint64;
+	static TArray<FViewpoint> Viewpoints;
+
+	static const TArray<FViewpoint> & Get(UWorld * World)
+	{
+		if (CachedFrame == GFrameCounter && CachedWorld.Get() == World)
+			return Viewpoints;
+
+		CachedWorld = World;
+		CachedFrame = GFrameCounter;
+		Viewpoints.Reset();
+
+		FRotator ViewRotation;
+
+		for (FConstPlayerControllerIterator Iterator = World->GetPlayerControllerIterator(); Iterator; ++Iterator)
+		{
+			if (APlayerController * PlayerController = Iterator->Get())
+			{
+				FViewpoint & Viewpoint = Viewpoints[Viewpoints.AddUninitialized()];
+				Viewpoint.Controller = PlayerController;
+				PlayerController->GetPlayerViewPoint(Viewpoint.Location, ViewRotation);
+			}
+		}
+
+		return Viewpoints;
+	}
 }
 
   //=============================================================================
@@ -96,6 +177,9 @@ UGripMotionControllerComponent::UGripMotionControllerComponent(const FObjectInit
 	bReppedOnce = false;
 	bOffsetByHMD = false;
 	bIsPostTeleport = false;
+	bUsesBatchedGripTick = false;
+	bGripLODActive = false;
+	bGripLODOutOfViewRange = false;
 
 	GripIDIncrementer = INVALID_VRGRIP_ID;
 
@@ -195,6 +279,7 @@ void UGripMotionControllerComponent::OnUnregister()
 		//DropObject(GrippedObjects[i].GrippedObject, false);	
 	}
 	GrippedObjects.Empty();
+	GrippedObjectsIndex.MarkDirty();
 
 	for (int i = 0; i < LocallyGrippedObjects.Num(); i++)
 	{
@@ -205,12 +290,14 @@ void UGripMotionControllerComponent::OnUnregister()
 		//DropObject(LocallyGrippedObjects[i].GrippedObject, false);
 	}
 	LocallyGrippedObjects.Empty();
+	LocallyGrippedObjectsIndex.MarkDirty();
 
 	for (int i = 0; i < PhysicsGrips.Num(); i++)
 	{
 		DestroyPhysicsHandle(/*PhysicsGrips[i].SceneIndex,*/ &PhysicsGrips[i].HandleData, &PhysicsGrips[i].KinActorData);
 	}
 	PhysicsGrips.Empty();
+	PhysicsGripsIndex.MarkDirty();
 
 	// Clear any timers that we are managing
 	if (UWorld * myWorld = GetWorld())
@@ -220,6 +307,14 @@ void UGripMotionControllerComponent::OnUnregister()
 
 	ObjectsWaitingForSocketUpdate.Empty();
 
+	if (bUsesBatchedGripTick)
+	{
+		if (GEngine)
+			GEngine->GetEngineSubsystem<UGripTickSubsystem>()->UnregisterController(this);
+
+		bUsesBatchedGripTick = false;
+	}
+
 	Super::OnUnregister();
 }
 
@@ -243,6 +338,11 @@ void UGripMotionControllerComponent::BeginDestroy()
 void UGripMotionControllerComponent::BeginPlay()
 {
 	Super::BeginPlay();
+
+	if (GripMotionControllerCvars::BatchGripTransforms > 0 && GEngine)
+	{
+		bUsesBatchedGripTick = GEngine->GetEngineSubsystem<UGripTickSubsystem>()->RegisterController(this);
+	}
 }
 
 void UGripMotionControllerComponent::CreateRenderState_Concurrent()
@@ -264,19 +364,20 @@ void UGripMotionControllerComponent::SendRenderTransform_Concurrent()
 
 FBPActorPhysicsHandleInformation * UGripMotionControllerComponent::GetPhysicsGrip(const FBPActorGripInformation & GripInfo)
 {
-	return PhysicsGrips.FindByKey(GripInfo);
+	int32 Index = PhysicsGripsIndex.FindByID(PhysicsGrips, GripInfo.GripID);
+	return Index != INDEX_NONE ? &PhysicsGrips[Index] : nullptr;
 }
 
 
 bool UGripMotionControllerComponent::GetPhysicsGripIndex(const FBPActorGripInformation & GripInfo, int & index)
 {
-	index = PhysicsGrips.IndexOfByKey(GripInfo);
+	index = PhysicsGripsIndex.FindByID(PhysicsGrips, GripInfo.GripID);
 	return index != INDEX_NONE;
 }
 
 FBPActorPhysicsHandleInformation * UGripMotionControllerComponent::CreatePhysicsGrip(const FBPActorGripInformation & GripInfo)
 {
-	FBPActorPhysicsHandleInformation * HandleInfo = PhysicsGrips.FindByKey(GripInfo);
+	FBPActorPhysicsHandleInformation * HandleInfo = GetPhysicsGrip(GripInfo);
 
 	if (HandleInfo)
 	{
@@ -289,6 +390,7 @@ FBPActorPhysicsHandleInformation * UGripMotionControllerComponent::CreatePhysics
 	NewInfo.GripID = GripInfo.GripID;
 
 	int index = PhysicsGrips.Add(NewInfo);
+	PhysicsGripsIndex.MarkDirty();
 
 	return &PhysicsGrips[index];
 }
@@ -316,6 +418,10 @@ void UGripMotionControllerComponent::PreReplication(IRepChangedPropertyTracker &
 	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeLocation, false);
 	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeRotation, false);
 	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeScale3D, false);
+
+	// The owning character records a compact pose stream into replays instead
+	const bool bSkipInReplay = ChangedPropertyTracker.IsReplay() && GetDefault<UVRGlobalSettings>()->bUseReplayPoseStream && Cast<AVRBaseCharacter>(GetOwner()) != nullptr;
+	DOREPLIFETIME_ACTIVE_OVERRIDE(UGripMotionControllerComponent, ReplicatedControllerTransform, !bSkipInReplay);
 }
 
 void UGripMotionControllerComponent::Server_SendControllerTransform_Implementation(FBPVRComponentPosRep NewTransform)
@@ -364,6 +470,32 @@ void UGripMotionControllerComponent::GetPhysicsVelocities(const FBPActorGripInfo
 	LinearVelocity = primComp->GetPhysicsLinearVelocity();
 }
 
+FBPActorGripInformation * UGripMotionControllerComponent::FindGripByID(uint8 GripID)
+{
+	int32 Index = GrippedObjectsIndex.FindByID(GrippedObjects, GripID);
+	if (Index != INDEX_NONE)
+		return &GrippedObjects[Index];
+
+	Index = LocallyGrippedObjectsIndex.FindByID(LocallyGrippedObjects, GripID);
+	if (Index != INDEX_NONE)
+		return &LocallyGrippedObjects[Index];
+
+	return nullptr;
+}
+
+FBPActorGripInformation * UGripMotionControllerComponent::FindGripByObject(const UObject * ObjectToFind)
+{
+	int32 Index = GrippedObjectsIndex.FindByObject(GrippedObjects, ObjectToFind);
+	if (Index != INDEX_NONE)
+		return &GrippedObjects[Index];
+
+	Index = LocallyGrippedObjectsIndex.FindByObject(LocallyGrippedObjects, ObjectToFind);
+	if (Index != INDEX_NONE)
+		return &LocallyGrippedObjects[Index];
+
+	return nullptr;
+}
+
 void UGripMotionControllerComponent::GetGripByActor(FBPActorGripInformation &Grip, AActor * ActorToLookForGrip, EBPVRResultSwitch &Result)
 {
 	if (!ActorToLookForGrip)
@@ -372,9 +504,7 @@ void UGripMotionControllerComponent::GetGripByActor(FBPActorGripInformation &Gri
 		return;
 	}
 
-	FBPActorGripInformation * GripInfo = GrippedObjects.FindByKey(ActorToLookForGrip);
-	if(!GripInfo)
-		GripInfo = LocallyGrippedObjects.FindByKey(ActorToLookForGrip);
+	FBPActorGripInformation * GripInfo = FindGripByObject(ActorToLookForGrip);
 	
 	if (GripInfo)
 	{
@@ -394,9 +524,7 @@ void UGripMotionControllerComponent::GetGripByComponent(FBPActorGripInformation
 		return;
 	}
 
-	FBPActorGripInformation * GripInfo = GrippedObjects.FindByKey(ComponentToLookForGrip);
-	if(!GripInfo)
-		GripInfo = LocallyGrippedObjects.FindByKey(ComponentToLookForGrip);
+	FBPActorGripInformation * GripInfo = FindGripByObject(ComponentToLookForGrip);
 
 	if (GripInfo)
 	{
@@ -416,9 +544,7 @@ void UGripMotionControllerComponent::GetGripByObject(FBPActorGripInformation &Gr
 		return;
 	}
 
-	FBPActorGripInformation * GripInfo = GrippedObjects.FindByKey(ObjectToLookForGrip);
-	if(!GripInfo)
-		GripInfo = LocallyGrippedObjects.FindByKey(ObjectToLookForGrip);
+	FBPActorGripInformation * GripInfo = FindGripByObject(ObjectToLookForGrip);
 
 	if (GripInfo)
 	{
@@ -438,9 +564,7 @@ void UGripMotionControllerComponent::GetGripByID(FBPActorGripInformation &Grip,
 		return;
 	}
 
-	FBPActorGripInformation * GripInfo = GrippedObjects.FindByKey(IDToLookForGrip);
-	if (!GripInfo)
-		GripInfo = LocallyGrippedObjects.FindByKey(IDToLookForGrip);
+	FBPActorGripInformation * GripInfo = FindGripByID(IDToLookForGrip);
 
 	if (GripInfo)
 	{
@@ -766,9 +890,7 @@ bool UGripMotionControllerComponent::DropObject(
 
 	if (ObjectToDrop != nullptr)
 	{
-		FBPActorGripInformation * GripInfo = GrippedObjects.FindByKey(ObjectToDrop);
-		if (!GripInfo)
-			GripInfo = LocallyGrippedObjects.FindByKey(ObjectToDrop);
+		FBPActorGripInformation * GripInfo = FindGripByObject(ObjectToDrop);
 
 		if (GripInfo != nullptr)
 		{
@@ -777,9 +899,7 @@ bool UGripMotionControllerComponent::DropObject(
 	}
 	else if (GripIDToDrop != INVALID_VRGRIP_ID)
 	{
-		FBPActorGripInformation * GripInfo = GrippedObjects.FindByKey(GripIDToDrop);
-		if (!GripInfo)
-			GripInfo = LocallyGrippedObjects.FindByKey(GripIDToDrop);
+		FBPActorGripInformation * GripInfo = FindGripByID(GripIDToDrop);
 
 		if (GripInfo != nullptr)
 		{
@@ -899,15 +1019,11 @@ bool UGripMotionControllerComponent::DropObjectByInterface(UObject * ObjectToDro
 	FBPActorGripInformation * GripInfo = nullptr;
 	if (ObjectToDrop != nullptr)
 	{
-		GripInfo = GrippedObjects.FindByKey(ObjectToDrop);
-		if (!GripInfo)
-			GripInfo = LocallyGrippedObjects.FindByKey(ObjectToDrop);
+		GripInfo = FindGripByObject(ObjectToDrop);
 	}
 	else if (GripIDToDrop != INVALID_VRGRIP_ID)
 	{
-		GripInfo = GrippedObjects.FindByKey(GripIDToDrop);
-		if (!GripInfo)
-			GripInfo = LocallyGrippedObjects.FindByKey(GripIDToDrop);
+		GripInfo = FindGripByID(GripIDToDrop);
 	}
 
 	if (GripInfo == nullptr)
@@ -1171,12 +1287,14 @@ bool UGripMotionControllerComponent::GripActor(
 	if (!bIsLocalGrip)
 	{
 		int32 Index = GrippedObjects.Add(newActorGrip);
+		GrippedObjectsIndex.MarkDirty();
 		if(Index != INDEX_NONE)
 			NotifyGrip(GrippedObjects[Index]);
 	}
 	else
 	{
 		int32 Index = LocallyGrippedObjects.Add(newActorGrip);
+		LocallyGrippedObjectsIndex.MarkDirty();
 
 		if(GetNetMode() == ENetMode::NM_Client && !IsTornOff() && newActorGrip.GripMovementReplicationSetting == EGripMovementReplicationSettings::ClientSide_Authoritive)
 			Server_NotifyLocalGripAddedOrChanged(newActorGrip);
@@ -1394,12 +1512,14 @@ bool UGripMotionControllerComponent::GripComponent(
 	if (!bIsLocalGrip)
 	{
 		int32 Index = GrippedObjects.Add(newComponentGrip);
+		GrippedObjectsIndex.MarkDirty();
 		if (Index != INDEX_NONE)
 			NotifyGrip(GrippedObjects[Index]);
 	}
 	else
 	{
 		int32 Index = LocallyGrippedObjects.Add(newComponentGrip);
+		LocallyGrippedObjectsIndex.MarkDirty();
 
 		if (GetNetMode() == ENetMode::NM_Client && !IsTornOff() && newComponentGrip.GripMovementReplicationSetting == EGripMovementReplicationSettings::ClientSide_Authoritive)
 			Server_NotifyLocalGripAddedOrChanged(newComponentGrip);
@@ -1513,7 +1633,7 @@ bool UGripMotionControllerComponent::DropGrip(const FBPActorGripInformation &Gri
 		{
 			if (!IsTornOff())
 			{
-				FTransform_NetQuantize TransformAtDrop = FTransform::Identity;
+				FTransform_NetQuantizeWorld TransformAtDrop = FTransform::Identity;
 
 				switch (LocallyGrippedObjects[FoundIndex].GripTargetType)
 				{
@@ -1743,12 +1863,12 @@ void UGripMotionControllerComponent::SetSocketTransform(UObject* ObjectToSocket,
 }
 
 
-bool UGripMotionControllerComponent::Server_NotifyDropAndSocketGrip_Validate(uint8 GripID, USceneComponent * SocketingParent, FName OptionalSocketName, const FTransform_NetQuantize & RelativeTransformToParent, bool bWeldBodies)
+bool UGripMotionControllerComponent::Server_NotifyDropAndSocketGrip_Validate(uint8 GripID, USceneComponent * SocketingParent, FName OptionalSocketName, const FTransform_NetQuantizeRelative & RelativeTransformToParent, bool bWeldBodies)
 {
 	return true;
 }
 
-void UGripMotionControllerComponent::Server_NotifyDropAndSocketGrip_Implementation(uint8 GripID, USceneComponent * SocketingParent, FName OptionalSocketName, const FTransform_NetQuantize & RelativeTransformToParent, bool bWeldBodies)
+void UGripMotionControllerComponent::Server_NotifyDropAndSocketGrip_Implementation(uint8 GripID, USceneComponent * SocketingParent, FName OptionalSocketName, const FTransform_NetQuantizeRelative & RelativeTransformToParent, bool bWeldBodies)
 {
 	FBPActorGripInformation FoundGrip;
 	EBPVRResultSwitch Result;
@@ -1982,6 +2102,7 @@ void UGripMotionControllerComponent::DropAndSocket_Implementation(const FBPActor
 		if (HasGripAuthority(NewDrop) || GetNetMode() < ENetMode::NM_Client)
 		{
 			LocallyGrippedObjects.RemoveAt(fIndex);
+			LocallyGrippedObjectsIndex.MarkDirty();
 		}
 		else
 			LocallyGrippedObjects[fIndex].bIsPaused = true; // Pause it instead of dropping, dropping can corrupt the array in rare cases
@@ -1994,6 +2115,7 @@ void UGripMotionControllerComponent::DropAndSocket_Implementation(const FBPActor
 			if (HasGripAuthority(NewDrop) || GetNetMode() < ENetMode::NM_Client)
 			{
 				GrippedObjects.RemoveAt(fIndex);
+				GrippedObjectsIndex.MarkDirty();
 			}
 			else
 				GrippedObjects[fIndex].bIsPaused = true; // Pause it instead of dropping, dropping can corrupt the array in rare cases
@@ -2132,6 +2254,9 @@ bool UGripMotionControllerComponent::NotifyGrip(FBPActorGripInformation &NewGrip
 	}break;
 	}
 
+	// Resolve the interface once here instead of every tick, re-inits rebuild it as the grip target may have changed
+	BuildGripDispatchCache(NewGrip, root, pActor);
+
 	switch (NewGrip.GripMovementReplicationSetting)
 	{
 	case EGripMovementReplicationSettings::ForceClientSideMovement:
@@ -2550,6 +2675,7 @@ void UGripMotionControllerComponent::Drop_Implementation(const FBPActorGripInfor
 		if (HasGripAuthority(NewDrop) || GetNetMode() < ENetMode::NM_Client)
 		{
 			LocallyGrippedObjects.RemoveAt(fIndex);
+			LocallyGrippedObjectsIndex.MarkDirty();
 		}
 		else
 			LocallyGrippedObjects[fIndex].bIsPaused = true; // Pause it instead of dropping, dropping can corrupt the array in rare cases
@@ -2562,6 +2688,7 @@ void UGripMotionControllerComponent::Drop_Implementation(const FBPActorGripInfor
 			if (HasGripAuthority(NewDrop) || GetNetMode() < ENetMode::NM_Client)
 			{
 				GrippedObjects.RemoveAt(fIndex);
+				GrippedObjectsIndex.MarkDirty();
 			}
 			else
 				GrippedObjects[fIndex].bIsPaused = true; // Pause it instead of dropping, dropping can corrupt the array in rare cases
@@ -3241,11 +3368,14 @@ void UGripMotionControllerComponent::TickComponent(float DeltaTime, enum ELevelT
 		// Don't bother with any of this if not replicating transform
 		if (bReplicates && (bTracked || bReplicateWithoutTracking))
 		{
+			// Runs every tick so that it sees the full motion between sends
+			const float SendRate = AdaptiveNetUpdateRate.Update(GetOwner(), DeltaTime, ReplicatedControllerTransform, this->RelativeLocation, this->RelativeRotation, ControllerNetUpdateRate);
+
 			// Don't rep if no changes
 			if (!this->RelativeLocation.Equals(ReplicatedControllerTransform.Position) || !this->RelativeRotation.Equals(ReplicatedControllerTransform.Rotation))
 			{
 				ControllerNetUpdateCount += DeltaTime;
-				if (ControllerNetUpdateCount >= (1.0f / ControllerNetUpdateRate))
+				if (ControllerNetUpdateCount >= (1.0f / SendRate))
 				{
 					ControllerNetUpdateCount = 0.0f;
 
@@ -3259,7 +3389,11 @@ void UGripMotionControllerComponent::TickComponent(float DeltaTime, enum ELevelT
 					if (GetNetMode() == NM_Client/* && !IsTornOff()*/)
 					{		
 						AVRBaseCharacter * OwningChar = Cast<AVRBaseCharacter>(GetOwner());
-						if (OverrideSendTransform != nullptr && OwningChar != nullptr)
+						if (OwningChar != nullptr && OverrideSendTransform != nullptr && OwningChar->StageTrackedPose(OwningChar->LeftMotionController == this ? FBPVRTrackedPoseFrame::Pose_LeftController : FBPVRTrackedPoseFrame::Pose_RightController, ReplicatedControllerTransform))
+						{
+							// Sent with the camera and other hand in the characters tracked pose frame
+						}
+						else if (OverrideSendTransform != nullptr && OwningChar != nullptr)
 						{
 							(OwningChar->* (OverrideSendTransform))(ReplicatedControllerTransform);
 						}
@@ -3272,7 +3406,17 @@ void UGripMotionControllerComponent::TickComponent(float DeltaTime, enum ELevelT
 	}
 	else
 	{
-		if (bLerpingPosition)
+		if (ReplicatedPoseBuffer.IsActive())
+		{
+			FVector BufferedPosition;
+			FRotator BufferedRotation;
+
+			if (ReplicatedPoseBuffer.Sample(GetWorld(), BufferedPosition, BufferedRotation))
+			{
+				SetRelativeLocationAndRotation(BufferedPosition, BufferedRotation);
+			}
+		}
+		else if (bLerpingPosition)
 		{
 			ControllerNetUpdateCount += DeltaTime;
 			float LerpVal = FMath::Clamp(ControllerNetUpdateCount / (1.0f / ControllerNetUpdateRate), 0.0f, 1.0f);
@@ -3300,12 +3444,28 @@ void UGripMotionControllerComponent::TickComponent(float DeltaTime, enum ELevelT
 		}
 	}
 
-	// Process the gripped actors
-	TickGrip(DeltaTime);
+	// Remote players hands on the server, client auth throws are checked against this history
+	if (!bHasAuthority && GetNetMode() < NM_Client)
+	{
+		const UVRGlobalSettings * VRSettings = GetDefault<UVRGlobalSettings>();
+
+		if (VRSettings->bValidateClientAuthMovement)
+		{
+			ServerPoseHistory.Record(GetWorld()->GetTimeSeconds(), GetComponentTransform(), VRSettings->ServerPoseHistoryMaxSamples);
+		}
+		else if (ServerPoseHistory.Num() > 0)
+		{
+			ServerPoseHistory.Reset();
+		}
+	}
+
+	// Process the gripped actors, when batched the UGripTickSubsystem does this after all of the controllers have updated
+	if (!bUsesBatchedGripTick)
+		TickGrip(DeltaTime);
 
 }
 
-bool UGripMotionControllerComponent::GetGripWorldTransform(TArray<UVRGripScriptBase*>& GripScripts, float DeltaTime, FTransform & WorldTransform, const FTransform &ParentTransform, FBPActorGripInformation &Grip, AActor * actor, UPrimitiveComponent * root, bool bRootHasInterface, bool bActorHasInterface, bool bIsForTeleport, bool &bForceADrop)
+bool UGripMotionControllerComponent::GetGripWorldTransform(TArrayView<UVRGripScriptBase*> GripScripts, float DeltaTime, FTransform & WorldTransform, const FTransform &ParentTransform, FBPActorGripInformation &Grip, AActor * actor, UPrimitiveComponent * root, bool bRootHasInterface, bool bActorHasInterface, bool bIsForTeleport, bool &bForceADrop)
 {
 	SCOPE_CYCLE_COUNTER(STAT_GetGripTransform);
 
@@ -3359,6 +3519,173 @@ bool UGripMotionControllerComponent::GetGripWorldTransform(TArray<UVRGripScriptB
 	return bHasValidTransform;
 }
 
+bool UGripMotionControllerComponent::IsBatchableGrip(const FBPActorGripInformation & Grip)
+{
+	if (Grip.GripID == INVALID_VRGRIP_ID || Grip.bIsPaused || !Grip.DispatchCache.bIsValid || !Grip.GrippedObject || Grip.GrippedObject->IsPendingKill())
+		return false;
+
+	if (Grip.GripCollisionType == EGripCollisionType::EventsOnly || Grip.GripCollisionType == EGripCollisionType::CustomGrip)
+		return false;
+
+	// Grips still waiting on their initial replication are skipped by the grip tick
+	if (!Grip.ValueCache.bWasInitiallyRepped && !HasGripAuthority(Grip))
+		return false;
+
+	return HasGripMovementAuthority(Grip);
+}
+
+bool UGripMotionControllerComponent::IsDefaultGripWorldTransform(const FBPActorGripInformation & Grip)
+{
+	// Only the stock default script is known to be a plain transform, an overridden one could be doing anything
+	if (!DefaultGripScript || DefaultGripScript->GetClass() != UGS_Default::StaticClass())
+		return false;
+
+	// Secondary grips and lerping out of them run the full GS_Default logic
+	if ((Grip.SecondaryGripInfo.bHasSecondaryAttachment && Grip.SecondaryGripInfo.SecondaryAttachment) || Grip.SecondaryGripInfo.GripLerpState == EGripLerpState::EndLerp)
+		return false;
+
+	for (UVRGripScriptBase* Script : Grip.DispatchCache.GripScripts)
+	{
+		if (Script->IsScriptActive() && Script->GetWorldTransformOverrideType() != EGSTransformOverrideType::None)
+			return false;
+	}
+
+	return IsBatchableGrip(Grip);
+}
+
+bool UGripMotionControllerComponent::CanEvaluateGripWorldTransformAsync(const FBPActorGripInformation & Grip)
+{
+	// Grips that can be LOD reduced have to decide whether to run their scripts in the grip tick, keep them there
+	if (GetDefault<UVRGlobalSettings>()->bUseGripLOD && !IsLocallyControlled())
+		return false;
+
+	// Mirrors the script selection in GetGripWorldTransform
+	bool bUsesDefaultScript = true;
+
+	for (UVRGripScriptBase* Script : Grip.DispatchCache.GripScripts)
+	{
+		if (!Script->IsScriptActive() || Script->GetWorldTransformOverrideType() == EGSTransformOverrideType::None)
+			continue;
+
+		if (!Script->IsThreadSafe_GetWorldTransform(Grip))
+			return false;
+
+		if (Script->GetWorldTransformOverrideType() == EGSTransformOverrideType::OverridesWorldTransform)
+			bUsesDefaultScript = false;
+	}
+
+	if (bUsesDefaultScript && DefaultGripScript && !DefaultGripScript->IsThreadSafe_GetWorldTransform(Grip))
+		return false;
+
+	return IsBatchableGrip(Grip);
+}
+
+void UGripMotionControllerComponent::BuildGripDispatchCache(FBPActorGripInformation & Grip, UPrimitiveComponent * root, AActor * actor)
+{
+	FBPActorGripInformation::FGripDispatchCache & Cache = Grip.DispatchCache;
+
+	// Reset instead of re-constructing so that the inline script storage is re-used
+	Cache.GripScripts.Reset();
+	Cache.CachedRoot = root;
+	Cache.CachedActor = actor;
+	Cache.bRootHasInterface = root && root->GetClass()->ImplementsInterface(UVRGripInterface::StaticClass());
+	Cache.bActorHasInterface = actor && actor->GetClass()->ImplementsInterface(UVRGripInterface::StaticClass());
+	Cache.NativeInterface = nullptr;
+
+	if (UObject * InterfaceObject = Cache.GetInterfaceObject())
+	{
+		// Blueprint overrides can only be reached through the Execute_ reflection path
+		if (GripDispatchCacheStatics::IsNativeEvent(InterfaceObject, GET_FUNCTION_NAME_CHECKED(IVRGripInterface, GetGripScripts)) &&
+			GripDispatchCacheStatics::IsNativeEvent(InterfaceObject, GET_FUNCTION_NAME_CHECKED(IVRGripInterface, GripBreakDistance)) &&
+			GripDispatchCacheStatics::IsNativeEvent(InterfaceObject, GET_FUNCTION_NAME_CHECKED(IVRGripInterface, SimulateOnDrop)))
+		{
+			Cache.NativeInterface = (IVRGripInterface*)InterfaceObject->GetNativeInterfaceAddress(UVRGripInterface::StaticClass());
+		}
+	}
+
+	RefreshGripDispatchCache(Grip);
+	Cache.bIsValid = true;
+}
+
+bool UGripMotionControllerComponent::RefreshGripDispatchCache(FBPActorGripInformation & Grip)
+{
+	FBPActorGripInformation::FGripDispatchCache & Cache = Grip.DispatchCache;
+	UObject * InterfaceObject = Cache.GetInterfaceObject();
+
+	if (!InterfaceObject)
+	{
+		// Non interfaced objects simulate on a forced drop
+		Cache.BreakDistance = 0.0f;
+		Cache.bSimulateOnDrop = true;
+
+		const bool bHadScripts = Cache.GripScripts.Num() > 0;
+		Cache.GripScripts.Reset();
+		return bHadScripts;
+	}
+
+	// The scripts and settings can be changed at any time while held, so they are re-read every tick
+	GripScriptsScratch.Reset();
+
+	if (Cache.NativeInterface)
+	{
+		Cache.NativeInterface->GetGripScripts_Implementation(GripScriptsScratch);
+		Cache.BreakDistance = Cache.NativeInterface->GripBreakDistance_Implementation();
+		Cache.bSimulateOnDrop = Cache.NativeInterface->SimulateOnDrop_Implementation();
+	}
+	else
+	{
+		IVRGripInterface::Execute_GetGripScripts(InterfaceObject, GripScriptsScratch);
+		Cache.BreakDistance = IVRGripInterface::Execute_GripBreakDistance(InterfaceObject);
+		Cache.bSimulateOnDrop = IVRGripInterface::Execute_SimulateOnDrop(InterfaceObject);
+	}
+
+	// Skip the null checks in the tick by not storing invalid entries
+	int32 NumScripts = 0;
+	bool bScriptsChanged = false;
+
+	for (UVRGripScriptBase* Script : GripScriptsScratch)
+	{
+		if (!Script)
+			continue;
+
+		if (!Cache.GripScripts.IsValidIndex(NumScripts) || Cache.GripScripts[NumScripts] != Script)
+		{
+			bScriptsChanged = true;
+			break;
+		}
+
+		++NumScripts;
+	}
+
+	if (!bScriptsChanged && NumScripts == Cache.GripScripts.Num())
+		return false;
+
+	Cache.GripScripts.Reset();
+
+	for (UVRGripScriptBase* Script : GripScriptsScratch)
+	{
+		if (Script)
+			Cache.GripScripts.Add(Script);
+	}
+
+	return true;
+}
+
+void UGripMotionControllerComponent::InvalidateGripDispatchCache(UObject * GrippedObjectToRefresh)
+{
+	for (FBPActorGripInformation & Grip : GrippedObjects)
+	{
+		if (!GrippedObjectToRefresh || Grip.GrippedObject == GrippedObjectToRefresh)
+			Grip.DispatchCache.Invalidate();
+	}
+
+	for (FBPActorGripInformation & Grip : LocallyGrippedObjects)
+	{
+		if (!GrippedObjectToRefresh || Grip.GrippedObject == GrippedObjectToRefresh)
+			Grip.DispatchCache.Invalidate();
+	}
+}
+
 void UGripMotionControllerComponent::TickGrip(float DeltaTime)
 {
 	SCOPE_CYCLE_COUNTER(STAT_TickGrip);
@@ -3373,6 +3700,8 @@ void UGripMotionControllerComponent::TickGrip(float DeltaTime)
 
 	FTransform ParentTransform = GetPivotTransform();
 
+	UpdateGripLODState();
+
 	// Split into separate functions so that I didn't have to combine arrays since I have some removal going on
 	HandleGripArray(GrippedObjects, ParentTransform, DeltaTime, true);
 	HandleGripArray(LocallyGrippedObjects, ParentTransform, DeltaTime);
@@ -3391,6 +3720,99 @@ void UGripMotionControllerComponent::TickGrip(float DeltaTime)
 	LastRelativePosition = this->GetRelativeTransform();
 }
 
+void UGripMotionControllerComponent::UpdateGripLODState()
+{
+	const UVRGlobalSettings * VRSettings = GetDefault<UVRGlobalSettings>();
+
+	bGripLODActive = VRSettings->bUseGripLOD && !IsLocallyControlled();
+	bGripLODOutOfViewRange = false;
+
+	UWorld * MyWorld = GetWorld();
+
+	// Nothing held, nothing to reduce
+	if (!bGripLODActive || VRSettings->GripLODDistance <= 0.0f || !MyWorld || (GrippedObjects.Num() < 1 && LocallyGrippedObjects.Num() < 1))
+		return;
+
+	// The owning player simulates their own client side grips, what the server does with them is only seen by everyone else
+	const APawn * OwningPawn = Cast<APawn>(GetOwner());
+	const AController * OwningController = OwningPawn ? OwningPawn->GetController() : nullptr;
+
+	const FVector ControllerLocation = GetComponentLocation();
+	const float MaxDistSq = FMath::Square(VRSettings->GripLODDistance);
+
+	for (const GripLODViewpoints::FViewpoint & Viewpoint : GripLODViewpoints::Get(MyWorld))
+	{
+		if (Viewpoint.Controller == OwningController)
+			continue;
+
+		if (FVector::DistSquared(Viewpoint.Location, ControllerLocation) <= MaxDistSq)
+			return;
+	}
+
+	bGripLODOutOfViewRange = true;
+}
+
+bool UGripMotionControllerComponent::TickReducedLODGrip(FBPActorGripInformation & Grip, UPrimitiveComponent * root, const FTransform & ParentTransform, float DeltaTime)
+{
+	const UVRGlobalSettings * VRSettings = GetDefault<UVRGlobalSettings>();
+
+	bool bReduce = bGripLODOutOfViewRange;
+
+	// Nothing renders on a dedicated server, only the distance applies there
+	if (!bReduce && VRSettings->GripLODNotRenderedTime > 0.0f && GetNetMode() != NM_DedicatedServer)
+		bReduce = !root->WasRecentlyRendered(VRSettings->GripLODNotRenderedTime);
+
+	// Server side movement is replicated to the owner who is always close to it
+	// Teleports, collisions, secondary grip changes and lerps are interactions, they promote the grip immediately
+	if (!bReduce ||
+		!Grip.bHasLODRelativeTransform ||
+		bIsPostTeleport ||
+		Grip.bColliding ||
+		Grip.GripMovementReplicationSetting == EGripMovementReplicationSettings::ForceServerSideMovement ||
+		Grip.LODSecondaryAttachment != Grip.SecondaryGripInfo.SecondaryAttachment ||
+		Grip.SecondaryGripInfo.GripLerpState != EGripLerpState::NotLerping)
+	{
+		Grip.LODUpdateInterval = Grip.LODTimeSinceUpdate + DeltaTime;
+		Grip.LODTimeSinceUpdate = 0.0f;
+		return false;
+	}
+
+	Grip.LODTimeSinceUpdate += DeltaTime;
+
+	if (Grip.LODTimeSinceUpdate >= 1.0f / FMath::Max(VRSettings->GripLODUpdateRate, 1.0f))
+	{
+		Grip.LODUpdateInterval = Grip.LODTimeSinceUpdate;
+		Grip.LODTimeSinceUpdate = 0.0f;
+		return false;
+	}
+
+	INC_DWORD_STAT(STAT_GripLODReducedUpdates);
+
+	// Continue the motion (relative to the hand) between the last two full updates up until the next one is due,
+	// so that the object doesn't sit still and then snap on every full update
+	const float Alpha = Grip.LODUpdateInterval > KINDA_SMALL_NUMBER ? FMath::Min(Grip.LODTimeSinceUpdate / Grip.LODUpdateInterval, 1.0f) : 0.0f;
+	const FTransform & Previous = Grip.LODPreviousRelativeTransform;
+	const FTransform & Current = Grip.LODRelativeTransform;
+
+	FTransform RelativeTransform = Current;
+	RelativeTransform.AddToTranslation((Current.GetTranslation() - Previous.GetTranslation()) * Alpha);
+	RelativeTransform.SetRotation(FQuat::Slerp(FQuat::Identity, Current.GetRotation() * Previous.GetRotation().Inverse(), Alpha) * Current.GetRotation());
+
+	FTransform WorldTransform = RelativeTransform * ParentTransform;
+
+	if (GetPhysicsGrip(Grip))
+	{
+		UpdatePhysicsHandleTransform(Grip, WorldTransform);
+	}
+	else if (Grip.GripCollisionType != EGripCollisionType::AttachmentGrip)
+	{
+		root->SetWorldTransform(WorldTransform, false);
+	}
+
+	Grip.LastWorldTransform = WorldTransform;
+	return true;
+}
+
 void UGripMotionControllerComponent::HandleGripArray(TArray<FBPActorGripInformation> &GrippedObjectsArray, const FTransform & ParentTransform, float DeltaTime, bool bReplicatedArray)
 {
 	if (GrippedObjectsArray.Num())
@@ -3407,6 +3829,11 @@ void UGripMotionControllerComponent::HandleGripArray(TArray<FBPActorGripInformat
 			if (!Grip) // Shouldn't be possible, but why not play it safe
 				continue;
 
+			// Consume the batched transform now so that a skipped grip can't use a stale one next frame
+			bool bHasBatchedTransform = Grip->bHasBatchedWorldTransform;
+			const bool bBatchTickedScripts = bHasBatchedTransform && Grip->bBatchedTickedScripts;
+			Grip->bHasBatchedWorldTransform = false;
+
 			// Double checking here for a failed rep due to out of order replication from a spawned actor
 			if (!Grip->ValueCache.bWasInitiallyRepped && !HasGripAuthority(*Grip) && !HandleGripReplication(*Grip))
 				continue; // If we didn't successfully handle the replication (out of order) then continue on.
@@ -3449,61 +3876,68 @@ void UGripMotionControllerComponent::HandleGripArray(TArray<FBPActorGripInformat
 				if (!root || !actor)
 					continue;
 
-				// Check if either implements the interface
-				bool bRootHasInterface = false;
-				bool bActorHasInterface = false;
-				
-				if (root->GetClass()->ImplementsInterface(UVRGripInterface::StaticClass()))
+				// Interface checks are resolved once per grip, only rebuild them if they were invalidated or the
+				// root / actor got swapped out from under us. The scripts and settings are refreshed every tick.
+				bool bScriptsChanged = false;
+				if (!Grip->DispatchCache.IsValidFor(root, actor))
 				{
-					bRootHasInterface = true;
+					BuildGripDispatchCache(*Grip, root, actor);
+					bScriptsChanged = true;
 				}
-				if (actor->GetClass()->ImplementsInterface(UVRGripInterface::StaticClass()))
+				else
 				{
-					// Actor grip interface is checked after component
-					bActorHasInterface = true;
+					bScriptsChanged = RefreshGripDispatchCache(*Grip);
 				}
 
+				// Scripts may have changed out from under the batch, but if it already ran them this frame then its
+				// result stands, the new scripts pick up on the next tick
+				if (bScriptsChanged && !bBatchTickedScripts)
+					bHasBatchedTransform = false;
+
+				// Actor grip interface is checked after component
+				const bool bRootHasInterface = Grip->DispatchCache.bRootHasInterface;
+				const bool bActorHasInterface = Grip->DispatchCache.bActorHasInterface;
+
 				if (Grip->GripCollisionType == EGripCollisionType::CustomGrip)
 				{
 					// Don't perform logic on the movement for this object, just pass in the GripTick() event with the controller difference instead
-					if(bRootHasInterface)
-						IVRGripInterface::Execute_TickGrip(root, this, *Grip, DeltaTime);
-					else if(bActorHasInterface)
-						IVRGripInterface::Execute_TickGrip(actor, this, *Grip, DeltaTime);
+					if (UObject * InterfaceObject = Grip->DispatchCache.GetInterfaceObject())
+						IVRGripInterface::Execute_TickGrip(InterfaceObject, this, *Grip, DeltaTime);
 
 					continue;
 				}
 
+				// Another players grip that no one is looking at, skip the scripts and sweeps for this tick
+				if (bGripLODActive && !bBatchTickedScripts && TickReducedLODGrip(*Grip, root, ParentTransform, DeltaTime))
+					continue;
+
 				bool bRescalePhysicsGrips = false;
 				
-				TArray<UVRGripScriptBase*> GripScripts;
+				// Scripts are stored inline on the grip, no allocation here
+				TArrayView<UVRGripScriptBase*> GripScripts(Grip->DispatchCache.GripScripts);
 
-				if (bRootHasInterface)
+				bool bForceADrop = false;
+				bool bHasValidWorldTransform = true;
+
+				if (bHasBatchedTransform)
 				{
-					IVRGripInterface::Execute_GetGripScripts(root, GripScripts);
+					// Already computed alongside the rest of the worlds grips by the UGripTickSubsystem
+					WorldTransform = Grip->BatchedWorldTransform;
+					bHasValidWorldTransform = Grip->bBatchedHasValidTransform;
+					bForceADrop = Grip->bBatchedForceDrop;
 				}
-				else if (bActorHasInterface)
+				else
 				{
-					IVRGripInterface::Execute_GetGripScripts(actor, GripScripts);
+					// Get the world transform for this grip after handling secondary grips and interaction differences
+					bHasValidWorldTransform = GetGripWorldTransform(GripScripts, DeltaTime, WorldTransform, ParentTransform, *Grip, actor, root, bRootHasInterface, bActorHasInterface, false, bForceADrop);
 				}
 
-
-				bool bForceADrop = false;
-
-				// Get the world transform for this grip after handling secondary grips and interaction differences
-				bool bHasValidWorldTransform = GetGripWorldTransform(GripScripts, DeltaTime, WorldTransform, ParentTransform, *Grip, actor, root, bRootHasInterface, bActorHasInterface, false, bForceADrop);
-
 				// If a script or behavior is telling us to skip this and continue on (IE: it dropped the grip)
 				if (bForceADrop)
 				{
 					if (HasGripAuthority(*Grip))
 					{
-						if (bRootHasInterface)
-							DropGrip(*Grip, IVRGripInterface::Execute_SimulateOnDrop(root));
-						else if (bActorHasInterface)
-							DropGrip(*Grip, IVRGripInterface::Execute_SimulateOnDrop(actor));
-						else
-							DropGrip(*Grip, true);
+						DropGrip(*Grip, Grip->DispatchCache.bSimulateOnDrop);
 					}
 
 					continue;
@@ -3513,6 +3947,17 @@ void UGripMotionControllerComponent::HandleGripArray(TArray<FBPActorGripInformat
 					continue;
 				}
 
+				if (bGripLODActive)
+				{
+					const FTransform LODRelativeTransform = WorldTransform.GetRelativeTransform(ParentTransform);
+
+					// Nothing to carry on from after a reset, start out still
+					Grip->LODPreviousRelativeTransform = Grip->bHasLODRelativeTransform ? Grip->LODRelativeTransform : LODRelativeTransform;
+					Grip->LODRelativeTransform = LODRelativeTransform;
+					Grip->LODSecondaryAttachment = Grip->SecondaryGripInfo.SecondaryAttachment;
+					Grip->bHasLODRelativeTransform = true;
+				}
+
 				if (!root->GetComponentScale().Equals(WorldTransform.GetScale3D()))
 					bRescalePhysicsGrips = true;
 
@@ -3549,16 +3994,7 @@ void UGripMotionControllerComponent::HandleGripArray(TArray<FBPActorGripInformat
 					}
 					else
 					{
-						float BreakDistance = 0.0f;
-						if (bRootHasInterface)
-						{
-							BreakDistance = IVRGripInterface::Execute_GripBreakDistance(root);
-						}
-						else if (bActorHasInterface)
-						{
-							// Actor grip interface is checked after component
-							BreakDistance = IVRGripInterface::Execute_GripBreakDistance(actor);
-						}
+						const float BreakDistance = Grip->DispatchCache.BreakDistance;
 
 						FVector CheckDistance;
 						if (!GetPhysicsJointLength(*Grip, root, CheckDistance))
@@ -3604,10 +4040,7 @@ void UGripMotionControllerComponent::HandleGripArray(TArray<FBPActorGripInformat
 								}
 								else if(HasGripAuthority(*Grip))
 								{
-									if(bRootHasInterface)
-										DropGrip(*Grip, IVRGripInterface::Execute_SimulateOnDrop(root));
-									else
-										DropGrip(*Grip, IVRGripInterface::Execute_SimulateOnDrop(actor));
+									DropGrip(*Grip, Grip->DispatchCache.bSimulateOnDrop);
 
 									// Don't bother moving it, it is dropped now
 									continue;
@@ -3666,6 +4099,16 @@ void UGripMotionControllerComponent::HandleGripArray(TArray<FBPActorGripInformat
 						if (Grip->bIsLocked)
 							WorldTransform.SetRotation(Grip->LastLockedRotation);
 
+						// Resting in a still hand, the last sweep got here unblocked so leave it where it is.
+						// No move means no new hit events either, anything that moves into the object still reports the hit from its own side.
+						if (CanSkipGripSweep(*Grip, WorldTransform, root))
+						{
+							INC_DWORD_STAT(STAT_GripSweepsSkipped);
+							break;
+						}
+
+						INC_DWORD_STAT(STAT_GripSweepsIssued);
+
 						FHitResult OutHit;
 						// Need to use without teleport so that the physics velocity is updated for when the actor is released to throw
 
@@ -3674,6 +4117,7 @@ void UGripMotionControllerComponent::HandleGripArray(TArray<FBPActorGripInformat
 						if (OutHit.bBlockingHit)
 						{
 							Grip->bColliding = true;
+							Grip->bHasLastSweptTransform = false;
 
 							if (!Grip->bIsLocked)
 							{
@@ -3684,6 +4128,8 @@ void UGripMotionControllerComponent::HandleGripArray(TArray<FBPActorGripInformat
 						else
 						{
 							Grip->bColliding = false;
+							Grip->LastSweptTransform = WorldTransform;
+							Grip->bHasLastSweptTransform = true;
 
 							if (Grip->bIsLocked)
 								Grip->bIsLocked = false;
@@ -3733,19 +4179,31 @@ void UGripMotionControllerComponent::HandleGripArray(TArray<FBPActorGripInformat
 						// Make sure that there is no collision on course before turning off collision and snapping to controller
 						FBPActorPhysicsHandleInformation * GripHandle = GetPhysicsGrip(*Grip);
 
-						TArray<FHitResult> Hits;
-						FComponentQueryParams Params(NAME_None, this->GetOwner());
-						//Params.bTraceAsyncScene = root->bCheckAsyncSceneOnMove;
-						Params.AddIgnoredActor(actor);
-						Params.AddIgnoredActors(root->MoveIgnoreActors);
-
-						if (GetWorld()->ComponentSweepMulti(Hits, root, root->GetComponentLocation(), WorldTransform.GetLocation(), WorldTransform.GetRotation(), Params))
+						if (CanSkipGripSweep(*Grip, WorldTransform, root))
 						{
-							Grip->bColliding = true;
+							INC_DWORD_STAT(STAT_GripSweepsSkipped);
 						}
 						else
 						{
-							Grip->bColliding = false;
+							INC_DWORD_STAT(STAT_GripSweepsIssued);
+
+							TArray<FHitResult> Hits;
+							FComponentQueryParams Params(NAME_None, this->GetOwner());
+							//Params.bTraceAsyncScene = root->bCheckAsyncSceneOnMove;
+							Params.AddIgnoredActor(actor);
+							Params.AddIgnoredActors(root->MoveIgnoreActors);
+
+							if (GetWorld()->ComponentSweepMulti(Hits, root, root->GetComponentLocation(), WorldTransform.GetLocation(), WorldTransform.GetRotation(), Params))
+							{
+								Grip->bColliding = true;
+								Grip->bHasLastSweptTransform = false;
+							}
+							else
+							{
+								Grip->bColliding = false;
+								Grip->LastSweptTransform = WorldTransform;
+								Grip->bHasLastSweptTransform = true;
+							}
 						}
 
 						if (!Grip->bColliding)
@@ -3810,6 +4268,7 @@ void UGripMotionControllerComponent::HandleGripArray(TArray<FBPActorGripInformat
 							// ComponentSweepMulti does nothing if moving < KINDA_SMALL_NUMBER in distance, so it's important to not try to sweep distances smaller than that. 
 							const float MinMovementDistSq = (FMath::Square(4.f*KINDA_SMALL_NUMBER));
 
+							// Never skipped, these sweeps don't move anything, they only exist for the hit / overlap events of the root and its children
 							if (bUseWithoutTracking || move.SizeSquared() > MinMovementDistSq || NewOrientation != OriginalOrientation)
 							{
 								if (CheckComponentWithSweep(root, move, OriginalOrientation, false))
@@ -3904,6 +4363,7 @@ void UGripMotionControllerComponent::CleanUpBadGrip(TArray<FBPActorGripInformati
 				// Need to delete it from the physics thread
 				DestroyPhysicsHandle(/*PhysicsGrips[g].SceneIndex, */&PhysicsGrips[g].HandleData, &PhysicsGrips[g].KinActorData);
 				PhysicsGrips.RemoveAt(g);
+				PhysicsGripsIndex.MarkDirty();
 			}
 		}
 	}
@@ -3933,6 +4393,7 @@ void UGripMotionControllerComponent::CleanUpBadPhysicsHandles()
 			// Need to delete it from the physics thread
 			DestroyPhysicsHandle(/*PhysicsGrips[g].SceneIndex,*/ &PhysicsGrips[g].HandleData, &PhysicsGrips[g].KinActorData);
 			PhysicsGrips.RemoveAt(g);
+			PhysicsGripsIndex.MarkDirty();
 		}
 	}
 }
@@ -3950,11 +4411,8 @@ bool UGripMotionControllerComponent::DestroyPhysicsHandle(/*int32 SceneIndex,*/
 			{
 				SCOPED_SCENE_WRITE_LOCK(PScene);
 
-				// Destroy joint.
-				(*HandleData)->release();
-
-				// Destroy temporary actor.
-				(*KinActorData)->release();
+				// Hands the joint and kinematic actor back to the scenes pool, or destroys them if it is full
+				FPhysicsGripHandlePool::ReleaseHandle(PScene, *KinActorData, *HandleData);
 			}
 			*KinActorData = NULL;
 			*HandleData = NULL;
@@ -3997,7 +4455,10 @@ bool UGripMotionControllerComponent::DestroyPhysicsHandle(const FBPActorGripInfo
 
 	int index;
 	if (GetPhysicsGripIndex(Grip, index))
+	{
 		PhysicsGrips.RemoveAt(index);
+		PhysicsGripsIndex.MarkDirty();
+	}
 
 	return true;
 }
@@ -4132,26 +4593,14 @@ bool UGripMotionControllerComponent::SetUpPhysicsHandle(const FBPActorGripInform
 			// If we don't already have a handle - make one now.
 			if (!HandleInfo->HandleData)
 			{
-				// Create kinematic actor we are going to create joint with. This will be moved around with calls to SetLocation/SetRotation.
-				PxRigidDynamic* KinActor = Scene->getPhysics().createRigidDynamic(KinPose);
-				KinActor->setRigidBodyFlag(PxRigidBodyFlag::eKINEMATIC, true);
-
-				KinActor->setMass(0.0f); // 1.0f;
-				KinActor->setMassSpaceInertiaTensor(PxVec3(0.0f, 0.0f, 0.0f));// PxVec3(1.0f, 1.0f, 1.0f));
-				KinActor->setMaxDepenetrationVelocity(PX_MAX_F32);
-
-				// No bodyinstance
-				KinActor->userData = NULL;
+				PxRigidDynamic* KinActor = NULL;
+				PxD6Joint* NewJoint = NULL;
 
-				// Add to Scene
-				Scene->addActor(*KinActor);
+				// Get the kinematic actor and joint, re-used from the scenes pool when possible instead of re-inserting into the scene.
+				FPhysicsGripHandlePool::AcquireHandle(Scene, KinPose, PActor, PActor->getGlobalPose().transformInv(KinPose), KinActor, NewJoint);
 
 				// Save reference to the kinematic actor.
 				HandleInfo->KinActorData = KinActor;
-				PxD6Joint* NewJoint = NULL;
-
-				// Create the joint
-				NewJoint = PxD6JointCreate(Scene->getPhysics(), KinActor, PxTransform(PxIdentity), PActor, PActor->getGlobalPose().transformInv(KinPose));
 
 				if (!NewJoint)
 				{
@@ -4460,6 +4909,26 @@ static void PullBackHitComp(FHitResult& Hit, const FVector& Start, const FVector
 	Hit.Time = FMath::Clamp(Hit.Time - DesiredTimeBack, 0.f, 1.f);
 }
 
+bool UGripMotionControllerComponent::CanSkipGripSweep(const FBPActorGripInformation & Grip, const FTransform & TargetTransform, const UPrimitiveComponent * root) const
+{
+	// Blocked grips keep sweeping so they can slide free, the world around them may have moved
+	if (!Grip.bHasLastSweptTransform || Grip.bColliding || bUseWithoutTracking || GripMotionControllerCvars::GripSweepSkipDistance <= 0.0f)
+		return false;
+
+	const float MaxDistSq = FMath::Square(GripMotionControllerCvars::GripSweepSkipDistance);
+	const float MaxAngle = FMath::DegreesToRadians(GripMotionControllerCvars::GripSweepSkipAngle);
+
+	// Something other than the grip moved the root, its overlaps are no longer known
+	const FTransform & RootTransform = root->GetComponentTransform();
+	if (FVector::DistSquared(RootTransform.GetLocation(), Grip.LastSweptTransform.GetLocation()) > MaxDistSq ||
+		RootTransform.GetRotation().AngularDistance(Grip.LastSweptTransform.GetRotation()) > MaxAngle)
+		return false;
+
+	return FVector::DistSquared(TargetTransform.GetLocation(), Grip.LastSweptTransform.GetLocation()) <= MaxDistSq &&
+		TargetTransform.GetRotation().AngularDistance(Grip.LastSweptTransform.GetRotation()) <= MaxAngle &&
+		TargetTransform.GetScale3D().Equals(Grip.LastSweptTransform.GetScale3D());
+}
+
 bool UGripMotionControllerComponent::CheckComponentWithSweep(UPrimitiveComponent * ComponentToCheck, FVector Move, FRotator newOrientation, bool bSkipSimulatingComponents/*,  bool &bHadBlockingHitOut*/)
 {
 	TArray<FHitResult> Hits;
@@ -4832,9 +5301,12 @@ void UGripMotionControllerComponent::Server_NotifyLocalGripAddedOrChanged_Implem
 		return;
 	}
 
-	if (!LocallyGrippedObjects.Contains(newGrip))
+	int32 IndexFound = LocallyGrippedObjectsIndex.FindByID(LocallyGrippedObjects, newGrip.GripID);
+
+	if (IndexFound == INDEX_NONE)
 	{
 		int32 NewIndex = LocallyGrippedObjects.Add(newGrip);
+		LocallyGrippedObjectsIndex.MarkDirty();
 
 		HandleGripReplication(LocallyGrippedObjects[NewIndex]);
 		// Initialize the differences, clients will do this themselves on the rep back, this sets up the cache
@@ -4842,12 +5314,9 @@ void UGripMotionControllerComponent::Server_NotifyLocalGripAddedOrChanged_Implem
 	}
 	else
 	{
-		int32 IndexFound;
-		if (LocallyGrippedObjects.Find(newGrip, IndexFound))
-		{
-			LocallyGrippedObjects[IndexFound].RepCopy(newGrip);
-			HandleGripReplication(LocallyGrippedObjects[IndexFound]);
-		}
+		LocallyGrippedObjects[IndexFound].RepCopy(newGrip);
+		LocallyGrippedObjectsIndex.MarkDirty();
+		HandleGripReplication(LocallyGrippedObjects[IndexFound]);
 	}
 
 	// Server has to call this themselves
@@ -4855,12 +5324,12 @@ void UGripMotionControllerComponent::Server_NotifyLocalGripAddedOrChanged_Implem
 }
 
 
-bool UGripMotionControllerComponent::Server_NotifyLocalGripRemoved_Validate(uint8 GripID, const FTransform_NetQuantize &TransformAtDrop, FVector_NetQuantize100 AngularVelocity, FVector_NetQuantize100 LinearVelocity)
+bool UGripMotionControllerComponent::Server_NotifyLocalGripRemoved_Validate(uint8 GripID, const FTransform_NetQuantizeWorld &TransformAtDrop, FVector_NetQuantize100 AngularVelocity, FVector_NetQuantize100 LinearVelocity)
 {
 	return true;
 }
 
-void UGripMotionControllerComponent::Server_NotifyLocalGripRemoved_Implementation(uint8 GripID, const FTransform_NetQuantize &TransformAtDrop, FVector_NetQuantize100 AngularVelocity, FVector_NetQuantize100 LinearVelocity)
+void UGripMotionControllerComponent::Server_NotifyLocalGripRemoved_Implementation(uint8 GripID, const FTransform_NetQuantizeWorld &TransformAtDrop, FVector_NetQuantize100 AngularVelocity, FVector_NetQuantize100 LinearVelocity)
 {
 	FBPActorGripInformation FoundGrip;
 	EBPVRResultSwitch Result;
@@ -4897,7 +5366,8 @@ void UGripMotionControllerComponent::Server_NotifySecondaryAttachmentChanged_Imp
 	const FBPSecondaryGripInfo& SecondaryGripInfo)
 {
 
-	FBPActorGripInformation * GripInfo = LocallyGrippedObjects.FindByKey(GripID);
+	int32 GripIndex = LocallyGrippedObjectsIndex.FindByID(LocallyGrippedObjects, GripID);
+	FBPActorGripInformation * GripInfo = GripIndex != INDEX_NONE ? &LocallyGrippedObjects[GripIndex] : nullptr;
 	if (GripInfo != nullptr)
 	{
 		// I override the = operator now so that it won't set the lerp components
@@ -4911,17 +5381,18 @@ void UGripMotionControllerComponent::Server_NotifySecondaryAttachmentChanged_Imp
 
 bool UGripMotionControllerComponent::Server_NotifySecondaryAttachmentChanged_Retain_Validate(
 	uint8 GripID,
-	const FBPSecondaryGripInfo& SecondaryGripInfo, const FTransform_NetQuantize & NewRelativeTransform)
+	const FBPSecondaryGripInfo& SecondaryGripInfo, const FTransform_NetQuantizeRelative & NewRelativeTransform)
 {
 	return true;
 }
 
 void UGripMotionControllerComponent::Server_NotifySecondaryAttachmentChanged_Retain_Implementation(
 	uint8 GripID,
-	const FBPSecondaryGripInfo& SecondaryGripInfo, const FTransform_NetQuantize & NewRelativeTransform)
+	const FBPSecondaryGripInfo& SecondaryGripInfo, const FTransform_NetQuantizeRelative & NewRelativeTransform)
 {
 
-	FBPActorGripInformation * GripInfo = LocallyGrippedObjects.FindByKey(GripID);
+	int32 GripIndex = LocallyGrippedObjectsIndex.FindByID(LocallyGrippedObjects, GripID);
+	FBPActorGripInformation * GripInfo = GripIndex != INDEX_NONE ? &LocallyGrippedObjects[GripIndex] : nullptr;
 	if (GripInfo != nullptr)
 	{
 		// I override the = operator now so that it won't set the lerp components
@@ -4973,6 +5444,7 @@ void UGripMotionControllerComponent::GetControllerDeviceID(FXRDeviceId & DeviceI
 FExpandedLateUpdateManager::FExpandedLateUpdateManager()
 	: LateUpdateGameWriteIndex(0)
 	, LateUpdateRenderReadIndex(0)
+	, SetupCounter(0)
 {
 	SkipLateUpdate[0] = false;
 	SkipLateUpdate[1] = false;
@@ -4989,7 +5461,8 @@ void FExpandedLateUpdateManager::Setup(const FTransform& ParentToWorld, UGripMot
 	LateUpdatePrimitives[LateUpdateGameWriteIndex].Reset();
 	SkipLateUpdate[LateUpdateGameWriteIndex] = bSkipLateUpdate;
 
-	TArray<USceneComponent*> ComponentsThatSkipLateUpdate;
+	++SetupCounter;
+	ComponentsThatSkipLateUpdate.Reset();
 
 	//Add additional late updates registered to this controller that aren't children and aren't gripped
 	//This array is editable in blueprint and can be used for things like arms or the like.
@@ -5005,6 +5478,13 @@ void FExpandedLateUpdateManager::Setup(const FTransform& ParentToWorld, UGripMot
 
 	GatherLateUpdatePrimitives(Component, &ComponentsThatSkipLateUpdate);
 
+	// Drop hierarchies of objects that are no longer gripped / late updated
+	for (auto It = CachedHierarchies.CreateIterator(); It; ++It)
+	{
+		if (It.Value().LastUsedSetup != SetupCounter)
+			It.RemoveCurrent();
+	}
+
 	LateUpdateGameWriteIndex = (LateUpdateGameWriteIndex + 1) % 2;
 }
 
@@ -5094,50 +5574,87 @@ void FExpandedLateUpdateManager::CacheSceneInfo(USceneComponent* Component)
 
 void FExpandedLateUpdateManager::GatherLateUpdatePrimitives(USceneComponent* ParentComponent, TArray<USceneComponent*> *SkipComponentList)
 {
-	CacheSceneInfo(ParentComponent);
-	TArray<USceneComponent*> DirectComponents;
+	if (!ParentComponent)
+		return;
 
-	if (SkipComponentList && SkipComponentList->Num())
+	FCachedLateUpdateHierarchy & Hierarchy = CachedHierarchies.FindOrAdd(ParentComponent);
+	Hierarchy.LastUsedSetup = SetupCounter;
+
+	if (!Hierarchy.IsUpToDate(SkipComponentList))
 	{
-		// Skip attachment grips, slower logic
-		ParentComponent->GetChildrenComponents(false, DirectComponents);
+		INC_DWORD_STAT(STAT_LateUpdateHierarchyRebuilds);
+		Hierarchy.Rebuild(ParentComponent, SkipComponentList);
+	}
 
-		TArray<USceneComponent*> SubComponents;
-		for (USceneComponent* Component : DirectComponents)
-		{
-			if (Component != nullptr && (SkipComponentList ? !SkipComponentList->Contains(Component) : true))
-			{
-				CacheSceneInfo(Component);
-				Component->GetChildrenComponents(true, SubComponents);
+	// Scene proxies can be re-created at any time, so only the components are cached
+	for (const FCachedLateUpdateHierarchy::FCachedComponent & Cached : Hierarchy.Components)
+	{
+		CacheSceneInfo(Cached.Component.Get());
+	}
+}
 
-				for (USceneComponent* SubComponent : SubComponents)
-				{
-					if (Component != nullptr)
-					{
-						CacheSceneInfo(SubComponent);
-					}
-				}
-			}
+bool FExpandedLateUpdateManager::FCachedLateUpdateHierarchy::IsUpToDate(const TArray<USceneComponent*> * SkipComponentList) const
+{
+	if (!Components.Num())
+		return false;
 
-		}
+	const int32 NumSkipComponents = SkipComponentList ? SkipComponentList->Num() : 0;
+	if (SkipComponents.Num() != NumSkipComponents || (NumSkipComponents && SkipComponents != *SkipComponentList))
+		return false;
+
+	for (int32 i = 0; i < Components.Num(); ++i)
+	{
+		const FCachedComponent & Cached = Components[i];
+		const USceneComponent * Component = Cached.Component.Get();
+
+		if (!Component || Component->GetAttachChildren().Num() != Cached.NumAttachChildren)
+			return false;
+
+		// A child swapped for another one keeps the count the same, but the one that left has a new parent
+		if (i > 0 && Component->GetAttachParent() != Cached.AttachParent)
+			return false;
 	}
-	else
+
+	return true;
+}
+
+void FExpandedLateUpdateManager::FCachedLateUpdateHierarchy::Rebuild(USceneComponent * Root, const TArray<USceneComponent*> * SkipComponentList)
+{
+	Components.Reset();
+	SkipComponents.Reset();
+
+	if (SkipComponentList)
+		SkipComponents.Append(*SkipComponentList);
+
+	FCachedComponent RootEntry;
+	RootEntry.Component = Root;
+	RootEntry.AttachParent = Root->GetAttachParent();
+	RootEntry.NumAttachChildren = Root->GetAttachChildren().Num();
+	Components.Add(RootEntry);
+
+	// Breadth first, the list itself is the queue
+	for (int32 i = 0; i < Components.Num(); ++i)
 	{
-		// Std late updates
-		ParentComponent->GetChildrenComponents(true, DirectComponents);
-		for (USceneComponent* Component : DirectComponents)
+		USceneComponent * Parent = Components[i].Component.Get();
+
+		for (USceneComponent * Child : Parent->GetAttachChildren())
 		{
-			if (Component != nullptr)
-			{
-				CacheSceneInfo(Component);
-			}
+			// Skip attachment grips, they are handled by the grip arrays
+			if (!Child || (i == 0 && SkipComponents.Contains(Child)))
+				continue;
+
+			FCachedComponent Entry;
+			Entry.Component = Child;
+			Entry.AttachParent = Parent;
+			Entry.NumAttachChildren = Child->GetAttachChildren().Num();
+			Components.Add(Entry);
 		}
 	}
 }
 
 void FExpandedLateUpdateManager::ProcessGripArrayLateUpdatePrimitives(UGripMotionControllerComponent * MotionControllerComponent, TArray<FBPActorGripInformation> & GripArray, TArray<USceneComponent*> &SkipComponentList)
 {
-	for (FBPActorGripInformation actor : GripArray)
+	for (const FBPActorGripInformation & actor : GripArray)
 	{
 		// Skip actors that are colliding if turning off late updates during collision.
 		// Also skip turning off late updates for SweepWithPhysics, as it should always be locked to the hand
@@ -5208,7 +5725,23 @@ void FExpandedLateUpdateManager::ProcessGripArrayLateUpdatePrimitives(UGripMotio
 		}
 
 		// Don't run late updates if we have a grip script that denies it
-		if (actor.GrippedObject->GetClass()->ImplementsInterface(UVRGripInterface::StaticClass()))
+		if (actor.DispatchCache.bIsValid)
+		{
+			// Use the scripts resolved at grip time instead of reflecting them again every frame
+			bool bContinueOn = false;
+			for (UVRGripScriptBase* Script : actor.DispatchCache.GripScripts)
+			{
+				if (Script->IsScriptActive() && Script->Wants_DenyLateUpdates())
+				{
+					bContinueOn = true;
+					break;
+				}
+			}
+
+			if (bContinueOn)
+				continue;
+		}
+		else if (actor.GrippedObject->GetClass()->ImplementsInterface(UVRGripInterface::StaticClass()))
 		{
 			TArray<UVRGripScriptBase*> GripScripts;
 			if (IVRGripInterface::Execute_GetGripScripts(actor.GrippedObject, GripScripts))
@@ -5286,7 +5819,7 @@ bool UGripMotionControllerComponent::GetIsObjectHeld(const UObject * ObjectToChe
 	if (!ObjectToCheck)
 		return false;
 
-	return (GrippedObjects.FindByKey(ObjectToCheck) || LocallyGrippedObjects.FindByKey(ObjectToCheck));
+	return FindGripByObject(ObjectToCheck) != nullptr;
 }
 
 bool UGripMotionControllerComponent::GetIsHeld(const AActor * ActorToCheck)
@@ -5294,7 +5827,7 @@ bool UGripMotionControllerComponent::GetIsHeld(const AActor * ActorToCheck)
 	if (!ActorToCheck)
 		return false;
 
-	return (GrippedObjects.FindByKey(ActorToCheck) || LocallyGrippedObjects.FindByKey(ActorToCheck));
+	return FindGripByObject(ActorToCheck) != nullptr;
 }
 
 bool UGripMotionControllerComponent::GetIsComponentHeld(const UPrimitiveComponent * ComponentToCheck)
@@ -5302,7 +5835,7 @@ bool UGripMotionControllerComponent::GetIsComponentHeld(const UPrimitiveComponen
 	if (!ComponentToCheck)
 		return false;
 
-	return (GrippedObjects.FindByKey(ComponentToCheck) || LocallyGrippedObjects.FindByKey(ComponentToCheck));
+	return FindGripByObject(ComponentToCheck) != nullptr;
 
 	return false;
 }
@@ -26,6 +26,12 @@ UGS_Default::UGS_Default(const FObjectInitializer& ObjectInitializer) :
 
 // Functions
 
+bool UGS_Default::IsThreadSafe_GetWorldTransform(const FBPActorGripInformation& Grip)
+{
+	// The secondary grip path calls into the interface and polls the other controller, only the plain transform is safe
+	return !((Grip.SecondaryGripInfo.bHasSecondaryAttachment && Grip.SecondaryGripInfo.SecondaryAttachment) || Grip.SecondaryGripInfo.GripLerpState == EGripLerpState::EndLerp);
+}
+
 bool UGS_Default::GetWorldTransform_Implementation
 (
 	UGripMotionControllerComponent* GrippingController, 
@@ -149,6 +149,16 @@ void UGS_GunTools::GetVirtualStockTarget(UGripMotionControllerComponent* Grippin
 	}
 }
 
+bool UGS_GunTools::IsThreadSafe_GetWorldTransform(const FBPActorGripInformation& Grip)
+{
+	// Recoil only touches our own state, the virtual stock and secondary grip paths query the engine / fire events
+	if ((Grip.SecondaryGripInfo.bHasSecondaryAttachment && Grip.SecondaryGripInfo.SecondaryAttachment) || Grip.SecondaryGripInfo.GripLerpState == EGripLerpState::EndLerp)
+		return false;
+
+	// Un-mounting broadcasts OnVirtualStockModeChanged
+	return !bIsMounted;
+}
+
 bool UGS_GunTools::GetWorldTransform_Implementation
 (
 	UGripMotionControllerComponent* GrippingController, 
@@ -5,6 +5,7 @@
 
 // Unreal
 #include "Math/DualQuat.h"
+#include "Async/Async.h"
 
 // VREP
 #include "GripMotionControllerComponent.h"
@@ -58,6 +59,28 @@ void UGS_LerpToHand::OnGripRelease_Implementation(UGripMotionControllerComponent
 	bIsActive = false;
 }
 
+bool UGS_LerpToHand::IsThreadSafe_GetWorldTransform(const FBPActorGripInformation& Grip)
+{
+	// Only touches our own lerp state, the finished event gets pushed back to the game thread
+	return true;
+}
+
+void UGS_LerpToHand::BroadcastLerpFinished()
+{
+	if (IsInGameThread())
+	{
+		OnLerpToHandFinished.Broadcast();
+		return;
+	}
+
+	TWeakObjectPtr<UGS_LerpToHand> WeakThis(this);
+	AsyncTask(ENamedThreads::GameThread, [WeakThis]()
+	{
+		if (WeakThis.IsValid())
+			WeakThis->OnLerpToHandFinished.Broadcast();
+	});
+}
+
 bool UGS_LerpToHand::GetWorldTransform_Implementation
 (
 	UGripMotionControllerComponent* GrippingController, 
@@ -90,7 +113,7 @@ bool UGS_LerpToHand::GetWorldTransform_Implementation
 			if (CurrentLerpTime > richCurve->GetLastKey().Time)
 			{
 				// Stop lerping
-				OnLerpToHandFinished.Broadcast();
+				BroadcastLerpFinished();
 				CurrentLerpTime = 0.0f;
 				bIsActive = false;
 				return true;
@@ -145,7 +168,7 @@ bool UGS_LerpToHand::GetWorldTransform_Implementation
 	// Turn it off if we need to
 	if (Alpha == 1.0f)
 	{
-		OnLerpToHandFinished.Broadcast();
+		BroadcastLerpFinished();
 		CurrentLerpTime = 0.0f;
 		bIsActive = false;
 	}
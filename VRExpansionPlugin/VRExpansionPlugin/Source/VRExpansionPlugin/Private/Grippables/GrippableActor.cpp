@@ -6,6 +6,8 @@
 // Unreal
 #include "TimerManager.h"
 #include "Net/UnrealNetwork.h"
+#include "VRBaseCharacter.h"
+#include "Misc/VRNetDormancyUtils.h"
 
 // VREP
 
@@ -48,6 +50,8 @@ AGrippableActor::AGrippableActor(const FObjectInitializer& ObjectInitializer) :
 	// Setting a minimum of every 3rd frame (VR 90fps) for replication consideration.
 	// Otherwise we will get some massive slow downs if the replication is allowed to hit the 2 per second minimum default.
 	MinNetUpdateFrequency = 30.0f;
+
+	LastInteractionTime = 0.0f;
 }
 
 AGrippableActor::~AGrippableActor()
@@ -61,6 +65,17 @@ AGrippableActor::~AGrippableActor()
 // Client Auth Throwing Data and functions 
 // ------------------------------------------------
 
+bool AGrippableActor::PollNetDormancy()
+{
+	// Interactibles on us (a slide, a dial) share our dormancy, so their state counts too
+	return FVRNetDormancyUtils::TryEnterOwnerDormancy(this);
+}
+
+float AGrippableActor::GetNetPriority(const FVector& ViewPos, const FVector& ViewDir, AActor* Viewer, AActor* ViewTarget, UActorChannel* InChannel, float Time, bool bLowBandwidth)
+{
+	return Super::GetNetPriority(ViewPos, ViewDir, Viewer, ViewTarget, InChannel, Time, bLowBandwidth) * FVRNetDormancyUtils::GetNetPriorityScale(this, LastInteractionTime);
+}
+
 void AGrippableActor::CeaseReplicationBlocking()
 {
 	ClientAuthReplicationData.bIsCurrentlyClientAuth = false;
@@ -108,7 +123,11 @@ bool AGrippableActor::PollReplicationEvent()
 
 				if (ClientAuthMovementRep.GatherActorsMovement(this))
 				{
-					Server_GetClientAuthReplication(ClientAuthMovementRep);
+					// Batched with the rest of the connections thrown objects if the owner is a VR character
+					if (!AVRBaseCharacter::QueueClientAuthThrow(this, ClientAuthMovementRep))
+					{
+						Server_GetClientAuthReplication(ClientAuthMovementRep);
+					}
 
 					if (PrimComp->RigidBodyIsAwake())
 					{
@@ -163,6 +182,9 @@ bool AGrippableActor::PollReplicationEvent()
 
 void AGrippableActor::Server_GetClientAuthReplication_Implementation(const FRepMovementVR& newMovement)
 {
+	if (!AVRBaseCharacter::ValidateClientAuthMovement(this, ClientAuthReplicationData, newMovement))
+		return;
+
 	newMovement.CopyTo(ReplicatedMovement);
 
 	OnRep_ReplicatedMovement();
@@ -198,6 +220,11 @@ void AGrippableActor::BeginPlay()
 	// Call the base class.
 	Super::BeginPlay();
 
+	if (FVRNetDormancyUtils::IsAutoDormancyEnabled(this))
+	{
+		FVRNetDormancyUtils::StartDormancyPolling(this, FName(TEXT("PollNetDormancy")));
+	}
+
 	// Call all grip scripts begin play events so they can perform any needed logic.
 	for (UVRGripScriptBase* Script : GripLogicScripts)
 	{
@@ -210,6 +237,8 @@ void AGrippableActor::BeginPlay()
 
 void AGrippableActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	GEngine->GetEngineSubsystem<UBucketUpdateSubsystem>()->RemoveObjectFromBucketByFunctionName(this, FName(TEXT("PollNetDormancy")));
+
 	if (ClientAuthReplicationData.bIsCurrentlyClientAuth)
 	{
 		GEngine->GetEngineSubsystem<UBucketUpdateSubsystem>()->RemoveObjectFromBucketByFunctionName(this, FName(TEXT("PollReplicationEvent")));
@@ -475,6 +504,9 @@ void AGrippableActor::SetHeld_Implementation(UGripMotionControllerComponent* Hol
 	{
 		VRGripInterfaceSettings.HoldingControllers.Remove(FBPGripPair(HoldingController, GripID));
 
+		// New throw, has to be validated against the hands again
+		ClientAuthReplicationData.bServerHasAcceptedMovement = false;
+
 		if (ClientAuthReplicationData.bUseClientAuthThrowing && ShouldWeSkipAttachmentReplication())
 		{
 			if (UPrimitiveComponent* PrimComp = Cast<UPrimitiveComponent>(GetRootComponent()))
@@ -496,6 +528,13 @@ void AGrippableActor::SetHeld_Implementation(UGripMotionControllerComponent* Hol
 	}
 
 	VRGripInterfaceSettings.bIsHeld = VRGripInterfaceSettings.HoldingControllers.Num() > 0;
+
+	FVRNetDormancyUtils::WakeActor(this, LastInteractionTime);
+
+	if (!VRGripInterfaceSettings.bIsHeld && FVRNetDormancyUtils::IsAutoDormancyEnabled(this))
+	{
+		FVRNetDormancyUtils::StartDormancyPolling(this, FName(TEXT("PollNetDormancy")));
+	}
 }
 
 bool AGrippableActor::SimulateOnDrop_Implementation()
@@ -8,7 +8,10 @@
 #include "UObject/Interface.h"
 
 // VREP
+#include "GripMotionControllerComponent.h"
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Physics Rep Targets Processed"), STAT_PhysicsRepTargetsProcessed, STATGROUP_TickGrip);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Physics Rep Targets Deferred"), STAT_PhysicsRepTargetsDeferred, STATGROUP_TickGrip);
 
 
 // Cpp Only
@@ -27,7 +30,9 @@ namespace VRPhysicsReplicationStatics
 
 // Constructor
 
-FPhysicsReplicationVR::FPhysicsReplicationVR(FPhysScene* PhysScene) : FPhysicsReplication(PhysScene)
+FPhysicsReplicationVR::FPhysicsReplicationVR(FPhysScene* PhysScene) : 
+	FPhysicsReplication(PhysScene),
+	RoundRobinIndex    (0        )
 {
 	VRPhysicsReplicationStatics::bHasVRPhysicsReplication = true;
 }
@@ -37,4 +42,149 @@ FPhysicsReplicationVR::FPhysicsReplicationVR(FPhysScene* PhysScene) : FPhysicsRe
 bool FPhysicsReplicationVR::IsInitialized()
 {
 	return VRPhysicsReplicationStatics::bHasVRPhysicsReplication;
-}
\ No newline at end of file
+}
+
+float FPhysicsReplicationVR::GetOwnerPingSeconds(const AActor * OwningActor)
+{
+	if (UPlayer* OwningPlayer = OwningActor ? OwningActor->GetNetOwningPlayer() : nullptr)
+	{
+		if (APlayerController* PlayerController = OwningPlayer->GetPlayerController(nullptr))
+		{
+			if (APlayerState* PlayerState = PlayerController->PlayerState)
+			{
+				return PlayerState->ExactPing * 0.001f;
+			}
+		}
+	}
+
+	return 0.0f;
+}
+
+void FPhysicsReplicationVR::OnTick(float DeltaSeconds, TMap<TWeakObjectPtr<UPrimitiveComponent>, FReplicatedPhysicsTarget>& ComponentsToTargets)
+{
+	const UWorld* OwningWorld = GetOwningWorld();
+
+	// Skip all of the custom logic if we aren't the server.
+	if (OwningWorld && OwningWorld->GetNetMode() == ENetMode::NM_Client)
+	{
+		return FPhysicsReplication::OnTick(DeltaSeconds, ComponentsToTargets);
+	}
+
+	const int32 NumTargets = ComponentsToTargets.Num();
+
+	if (NumTargets < 1)
+	{
+		RoundRobinIndex = 0;
+		LastProcessedTimes.Reset();
+		return;
+	}
+
+	const FRigidBodyErrorCorrection& PhysicErrorCorrection = UPhysicsSettings::Get()->PhysicErrorCorrection;
+	const UVRGlobalSettings* VRSettings = GetDefault<UVRGlobalSettings>();
+	const float CurrentTimeSeconds = OwningWorld ? OwningWorld->GetTimeSeconds() : 0.0f;
+
+	// Looked up once per tick instead of per component
+	static const auto CVarSkipSkeletalRepOptimization = IConsoleManager::Get().FindConsoleVariable(TEXT("p.SkipSkeletalRepOptimization"));
+	const bool bSkipSkeletalSync = CVarSkipSkeletalRepOptimization && CVarSkipSkeletalRepOptimization->GetInt() != 0;
+
+	const int32 MaxTargets = VRSettings->PhysicsReplicationMaxTargetsPerTick > 0 ? FMath::Min(VRSettings->PhysicsReplicationMaxTargetsPerTick, NumTargets) : NumTargets;
+	const double TimeBudget = VRSettings->PhysicsReplicationMaxTickTimeMs * 0.001;
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Snapshot the keys so that targets can be walked from where the last tick left off and removed as we go
+	TargetKeys.Reset(NumTargets);
+	ComponentsToTargets.GetKeys(TargetKeys);
+
+	const int32 StartIndex = RoundRobinIndex % NumTargets;
+	int32 NumProcessed = 0;
+
+	for (; NumProcessed < MaxTargets; ++NumProcessed)
+	{
+		// Always process at least one so that nothing can starve
+		if (NumProcessed > 0 && TimeBudget > 0.0 && (FPlatformTime::Seconds() - StartTime) >= TimeBudget)
+			break;
+
+		const TWeakObjectPtr<UPrimitiveComponent>& Key = TargetKeys[(StartIndex + NumProcessed) % NumTargets];
+		FReplicatedPhysicsTarget* PhysicsTarget = ComponentsToTargets.Find(Key);
+
+		if (!PhysicsTarget)
+			continue;
+
+		bool bRemoveTarget = false;
+
+		/*
+		Its been more than half a second since the last update, lets cease using the target as a failsafe.
+		Clients will never update with that much latency, and if they somehow are, then they are dropping so many.
+		packets that it will be useless to use their data anyway.
+		*/
+		if ((CurrentTimeSeconds - PhysicsTarget->ArrivedTimeSeconds) > 0.5f)
+		{
+			bRemoveTarget = true;
+		}
+		else if (UPrimitiveComponent* PrimComp = Key.Get())
+		{
+			// A target that was deferred by the budget has to be corrected for all of the time since it was last processed, not just this tick
+			const float * LastProcessedTime = LastProcessedTimes.Find(Key);
+			const float ElapsedSeconds = LastProcessedTime ? FMath::Max(CurrentTimeSeconds - *LastProcessedTime, DeltaSeconds) : DeltaSeconds;
+			LastProcessedTimes.Add(Key, CurrentTimeSeconds);
+
+			bRemoveTarget = ProcessTarget(ElapsedSeconds, PrimComp, *PhysicsTarget, PhysicErrorCorrection, bSkipSkeletalSync);
+		}
+
+		if (bRemoveTarget)
+		{
+			OnTargetRestored(Key.Get(), *PhysicsTarget);
+			LastProcessedTimes.Remove(Key);
+			ComponentsToTargets.Remove(Key);
+		}
+	}
+
+	// Targets can also be removed by the engine (RemoveReplicatedTarget), drop their times so a new target doesn't pick them up
+	if (LastProcessedTimes.Num() > ComponentsToTargets.Num())
+	{
+		for (auto It = LastProcessedTimes.CreateIterator(); It; ++It)
+		{
+			if (!ComponentsToTargets.Contains(It.Key()))
+				It.RemoveCurrent();
+		}
+	}
+
+	// Removed targets shift the order a little, which is fine, everything still gets its turn
+	RoundRobinIndex = StartIndex + NumProcessed;
+
+	INC_DWORD_STAT_BY(STAT_PhysicsRepTargetsProcessed, NumProcessed);
+	INC_DWORD_STAT_BY(STAT_PhysicsRepTargetsDeferred, NumTargets - NumProcessed);
+}
+
+bool FPhysicsReplicationVR::ProcessTarget(float DeltaSeconds, UPrimitiveComponent * PrimComp, FReplicatedPhysicsTarget & PhysicsTarget, const FRigidBodyErrorCorrection & PhysicErrorCorrection, bool bSkipSkeletalSync)
+{
+	FBodyInstance* BI = PrimComp->GetBodyInstance(PhysicsTarget.BoneName);
+	AActor* OwningActor = PrimComp->GetOwner();
+
+	if (!BI || !OwningActor)
+		return false;
+
+	FRigidBodyState& UpdatedState = PhysicsTarget.TargetState;
+
+	if (!(UpdatedState.Flags & ERigidBodyFlags::NeedsUpdate))
+		return false;
+
+	/*
+	Get the total ping - this approximates the time since the update was
+	actually generated on the machine that is doing the authoritative sim.
+	We are always the server here so there is no local ping to add.
+	// NOTE: We divide by 2 to approximate 1-way ping from 2-way ping.
+	*/
+	const float PingSecondsOneWay = FMath::Clamp(GetOwnerPingSeconds(OwningActor) * 0.5f, 0.0f, GetDefault<UVRGlobalSettings>()->PhysicsReplicationMaxPingCompensation);
+
+	const bool bRestoredState = ApplyRigidBodyState(DeltaSeconds, BI, PhysicsTarget, PhysicErrorCorrection, PingSecondsOneWay);
+
+	//Simulated skeletal mesh does its own polling of physics results so we don't need to call this as it'll happen at the end of the physics sim.
+	if (!bSkipSkeletalSync || Cast<USkeletalMeshComponent>(PrimComp) == nullptr)
+	{
+		PrimComp->SyncComponentToRBPhysics();
+	}
+
+	// Added a sleeping check from the input state as well, we always want to cease activity on sleep.
+	return bRestoredState || ((UpdatedState.Flags & ERigidBodyFlags::Sleeping) != 0);
+}
@@ -6,6 +6,8 @@
 // Unreal
 #include "TimerManager.h"
 #include "Net/UnrealNetwork.h"
+#include "VRBaseCharacter.h"
+#include "Misc/VRNetDormancyUtils.h"
 
 // VREP
 
@@ -82,6 +84,8 @@ AGrippableSkeletalMeshActor::AGrippableSkeletalMeshActor(const FObjectInitialize
 	// Setting a minimum of every 3rd frame (VR 90fps) for replication consideration
 	// Otherwise we will get some massive slow downs if the replication is allowed to hit the 2 per second minimum default
 	MinNetUpdateFrequency = 30.0f;
+
+	LastInteractionTime = 0.0f;
 }
 
 AGrippableSkeletalMeshActor::~AGrippableSkeletalMeshActor()
@@ -99,6 +103,17 @@ void AGrippableSkeletalMeshActor::SetDenyGripping(bool bDenyGripping)
 // Client Auth Throwing Data and functions 
 // ------------------------------------------------
 
+bool AGrippableSkeletalMeshActor::PollNetDormancy()
+{
+	// Interactibles on us (a slide, a dial) share our dormancy, so their state counts too
+	return FVRNetDormancyUtils::TryEnterOwnerDormancy(this);
+}
+
+float AGrippableSkeletalMeshActor::GetNetPriority(const FVector& ViewPos, const FVector& ViewDir, AActor* Viewer, AActor* ViewTarget, UActorChannel* InChannel, float Time, bool bLowBandwidth)
+{
+	return Super::GetNetPriority(ViewPos, ViewDir, Viewer, ViewTarget, InChannel, Time, bLowBandwidth) * FVRNetDormancyUtils::GetNetPriorityScale(this, LastInteractionTime);
+}
+
 void AGrippableSkeletalMeshActor::CeaseReplicationBlocking()
 {
 	ClientAuthReplicationData.bIsCurrentlyClientAuth = false;
@@ -140,7 +155,11 @@ bool AGrippableSkeletalMeshActor::PollReplicationEvent()
 
 				if (ClientAuthMovementRep.GatherActorsMovement(this))
 				{
-					Server_GetClientAuthReplication(ClientAuthMovementRep);
+					// Batched with the rest of the connections thrown objects if the owner is a VR character
+					if (!AVRBaseCharacter::QueueClientAuthThrow(this, ClientAuthMovementRep))
+					{
+						Server_GetClientAuthReplication(ClientAuthMovementRep);
+					}
 
 					if (PrimComp->RigidBodyIsAwake())
 					{
@@ -199,6 +218,9 @@ bool AGrippableSkeletalMeshActor::Server_GetClientAuthReplication_Validate(const
 
 void AGrippableSkeletalMeshActor::Server_GetClientAuthReplication_Implementation(const FRepMovementVR& newMovement)
 {
+	if (!AVRBaseCharacter::ValidateClientAuthMovement(this, ClientAuthReplicationData, newMovement))
+		return;
+
 	newMovement.CopyTo(ReplicatedMovement);
 	OnRep_ReplicatedMovement();
 }
@@ -228,6 +250,11 @@ void AGrippableSkeletalMeshActor::BeginPlay()
 	// Call the base class 
 	Super::BeginPlay();
 
+	if (FVRNetDormancyUtils::IsAutoDormancyEnabled(this))
+	{
+		FVRNetDormancyUtils::StartDormancyPolling(this, FName(TEXT("PollNetDormancy")));
+	}
+
 	// Call all grip scripts begin play events so they can perform any needed logic
 	for (UVRGripScriptBase* Script : GripLogicScripts)
 	{
@@ -240,6 +267,8 @@ void AGrippableSkeletalMeshActor::BeginPlay()
 
 void AGrippableSkeletalMeshActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	GEngine->GetEngineSubsystem<UBucketUpdateSubsystem>()->RemoveObjectFromBucketByFunctionName(this, FName(TEXT("PollNetDormancy")));
+
 	if (ClientAuthReplicationData.bIsCurrentlyClientAuth)
 	{
 		GEngine->GetEngineSubsystem<UBucketUpdateSubsystem>()->RemoveObjectFromBucketByFunctionName(this, FName(TEXT("PollReplicationEvent")));
@@ -473,6 +502,9 @@ void AGrippableSkeletalMeshActor::SetHeld_Implementation(UGripMotionControllerCo
 	{
 		VRGripInterfaceSettings.HoldingControllers.Remove(FBPGripPair(HoldingController, GripID));
 
+		// New throw, has to be validated against the hands again
+		ClientAuthReplicationData.bServerHasAcceptedMovement = false;
+
 			if (ClientAuthReplicationData.bUseClientAuthThrowing && ShouldWeSkipAttachmentReplication())
 			{
 				if (UPrimitiveComponent * PrimComp = Cast<UPrimitiveComponent>(GetRootComponent()))
@@ -491,6 +523,13 @@ void AGrippableSkeletalMeshActor::SetHeld_Implementation(UGripMotionControllerCo
 	}
 
 	VRGripInterfaceSettings.bIsHeld = VRGripInterfaceSettings.HoldingControllers.Num() > 0;
+
+	FVRNetDormancyUtils::WakeActor(this, LastInteractionTime);
+
+	if (!VRGripInterfaceSettings.bIsHeld && FVRNetDormancyUtils::IsAutoDormancyEnabled(this))
+	{
+		FVRNetDormancyUtils::StartDormancyPolling(this, FName(TEXT("PollNetDormancy")));
+	}
 }
 
 bool AGrippableSkeletalMeshActor::SimulateOnDrop_Implementation()
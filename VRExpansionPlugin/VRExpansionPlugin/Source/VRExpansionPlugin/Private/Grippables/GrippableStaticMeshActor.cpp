@@ -6,6 +6,8 @@
 // Unreal
 #include "TimerManager.h"
 #include "Net/UnrealNetwork.h"
+#include "VRBaseCharacter.h"
+#include "Misc/VRNetDormancyUtils.h"
 
 // VREP
 
@@ -93,6 +95,8 @@ AGrippableStaticMeshActor::AGrippableStaticMeshActor(const FObjectInitializer& O
 	// Setting a minimum of every 3rd frame (VR 90fps) for replication consideration
 	// Otherwise we will get some massive slow downs if the replication is allowed to hit the 2 per second minimum default
 	MinNetUpdateFrequency = 30.0f;
+
+	LastInteractionTime = 0.0f;
 }
 
 AGrippableStaticMeshActor::~AGrippableStaticMeshActor()
@@ -110,6 +114,17 @@ void AGrippableStaticMeshActor::SetDenyGripping(bool bDenyGripping)
 // Client Auth Throwing Data and functions 
 // ------------------------------------------------
 
+bool AGrippableStaticMeshActor::PollNetDormancy()
+{
+	// Interactibles on us (a slide, a dial) share our dormancy, so their state counts too
+	return FVRNetDormancyUtils::TryEnterOwnerDormancy(this);
+}
+
+float AGrippableStaticMeshActor::GetNetPriority(const FVector& ViewPos, const FVector& ViewDir, AActor* Viewer, AActor* ViewTarget, UActorChannel* InChannel, float Time, bool bLowBandwidth)
+{
+	return Super::GetNetPriority(ViewPos, ViewDir, Viewer, ViewTarget, InChannel, Time, bLowBandwidth) * FVRNetDormancyUtils::GetNetPriorityScale(this, LastInteractionTime);
+}
+
 void AGrippableStaticMeshActor::CeaseReplicationBlocking()
 {
 	ClientAuthReplicationData.bIsCurrentlyClientAuth = false;
@@ -150,7 +165,11 @@ bool AGrippableStaticMeshActor::PollReplicationEvent()
 				FRepMovementVR ClientAuthMovementRep;
 				if (ClientAuthMovementRep.GatherActorsMovement(this))
 				{
-					Server_GetClientAuthReplication(ClientAuthMovementRep);
+					// Batched with the rest of the connections thrown objects if the owner is a VR character
+					if (!AVRBaseCharacter::QueueClientAuthThrow(this, ClientAuthMovementRep))
+					{
+						Server_GetClientAuthReplication(ClientAuthMovementRep);
+					}
 
 					if (PrimComp->RigidBodyIsAwake())
 						return true;
@@ -207,6 +226,9 @@ bool AGrippableStaticMeshActor::Server_GetClientAuthReplication_Validate(const F
 
 void AGrippableStaticMeshActor::Server_GetClientAuthReplication_Implementation(const FRepMovementVR& newMovement)
 {
+	if (!AVRBaseCharacter::ValidateClientAuthMovement(this, ClientAuthReplicationData, newMovement))
+		return;
+
 	newMovement.CopyTo(ReplicatedMovement);
 	OnRep_ReplicatedMovement();
 }
@@ -236,6 +258,11 @@ void AGrippableStaticMeshActor::BeginPlay()
 	// Call the base class 
 	Super::BeginPlay();
 
+	if (FVRNetDormancyUtils::IsAutoDormancyEnabled(this))
+	{
+		FVRNetDormancyUtils::StartDormancyPolling(this, FName(TEXT("PollNetDormancy")));
+	}
+
 	// Call all grip scripts begin play events so they can perform any needed logic
 	for (UVRGripScriptBase* Script : GripLogicScripts)
 	{
@@ -248,6 +275,8 @@ void AGrippableStaticMeshActor::BeginPlay()
 
 void AGrippableStaticMeshActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	GEngine->GetEngineSubsystem<UBucketUpdateSubsystem>()->RemoveObjectFromBucketByFunctionName(this, FName(TEXT("PollNetDormancy")));
+
 	if (ClientAuthReplicationData.bIsCurrentlyClientAuth)
 	{
 		GEngine->GetEngineSubsystem<UBucketUpdateSubsystem>()->RemoveObjectFromBucketByFunctionName(this, FName(TEXT("PollReplicationEvent")));
@@ -476,6 +505,9 @@ void AGrippableStaticMeshActor::SetHeld_Implementation(UGripMotionControllerComp
 	{
 		VRGripInterfaceSettings.HoldingControllers.Remove(FBPGripPair(HoldingController, GripID));
 
+		// New throw, has to be validated against the hands again
+		ClientAuthReplicationData.bServerHasAcceptedMovement = false;
+
 		if (ClientAuthReplicationData.bUseClientAuthThrowing && ShouldWeSkipAttachmentReplication())
 		{
 			if (UPrimitiveComponent * PrimComp = Cast<UPrimitiveComponent>(GetRootComponent()))
@@ -494,6 +526,13 @@ void AGrippableStaticMeshActor::SetHeld_Implementation(UGripMotionControllerComp
 	}
 
 	VRGripInterfaceSettings.bIsHeld = VRGripInterfaceSettings.HoldingControllers.Num() > 0;
+
+	FVRNetDormancyUtils::WakeActor(this, LastInteractionTime);
+
+	if (!VRGripInterfaceSettings.bIsHeld && FVRNetDormancyUtils::IsAutoDormancyEnabled(this))
+	{
+		FVRNetDormancyUtils::StartDormancyPolling(this, FName(TEXT("PollNetDormancy")));
+	}
 }
 
 bool AGrippableStaticMeshActor::SimulateOnDrop_Implementation()
@@ -2,6 +2,7 @@
 
 #include "Interactibles/VRDialComponent.h"
 #include "Net/UnrealNetwork.h"
+#include "Misc/VRNetDormancyUtils.h"
 
   //=============================================================================
 UVRDialComponent::UVRDialComponent(const FObjectInitializer& ObjectInitializer)
@@ -11,6 +12,8 @@ UVRDialComponent::UVRDialComponent(const FObjectInitializer& ObjectInitializer)
 	this->PrimaryComponentTick.bStartWithTickEnabled = false;
 	PrimaryComponentTick.bCanEverTick = true;
 
+	LastInteractionTime = 0.0f;
+
 	bRepGameplayTags = false;
 
 	// Defaulting these true so that they work by default in networked environments
@@ -83,11 +86,24 @@ void UVRDialComponent::BeginPlay()
 {
 	// Call the base class 
 	Super::BeginPlay();
+
+	if (FVRNetDormancyUtils::IsAutoDormancyEnabled(GetOwner()))
+	{
+		FVRNetDormancyUtils::StartDormancyPolling(this, FName(TEXT("PollNetDormancy")));
+	}
+
 	CalculateDialProgress();
 
 	bOriginalReplicatesMovement = bReplicateMovement;
 }
 
+void UVRDialComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	FVRNetDormancyUtils::StopDormancyPolling(this, FName(TEXT("PollNetDormancy")));
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void UVRDialComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
 {
 	if (bIsLerping)
@@ -327,6 +343,18 @@ void UVRDialComponent::SetHeld_Implementation(UGripMotionControllerComponent * N
 	}
 
 	bIsHeld = bNewIsHeld;
+
+	FVRNetDormancyUtils::WakeActor(GetOwner(), LastInteractionTime);
+
+	if (!bIsHeld && FVRNetDormancyUtils::IsAutoDormancyEnabled(GetOwner()))
+	{
+		FVRNetDormancyUtils::StartDormancyPolling(this, FName(TEXT("PollNetDormancy")));
+	}
+}
+
+bool UVRDialComponent::PollNetDormancy()
+{
+	return FVRNetDormancyUtils::TryEnterOwnerDormancy(GetOwner());
 }
 
 /*FBPInteractionSettings UVRDialComponent::GetInteractionSettings_Implementation()
@@ -2,6 +2,7 @@
 
 #include "Interactibles/VRLeverComponent.h"
 #include "Net/UnrealNetwork.h"
+#include "Misc/VRNetDormancyUtils.h"
 
   //=============================================================================
 UVRLeverComponent::UVRLeverComponent(const FObjectInitializer& ObjectInitializer)
@@ -11,6 +12,8 @@ UVRLeverComponent::UVRLeverComponent(const FObjectInitializer& ObjectInitializer
 	this->PrimaryComponentTick.bStartWithTickEnabled = false;
 	PrimaryComponentTick.bCanEverTick = true;
 
+	LastInteractionTime = 0.0f;
+
 	bRepGameplayTags = false;
 
 	// Defaulting these true so that they work by default in networked environments
@@ -106,11 +109,24 @@ void UVRLeverComponent::BeginPlay()
 {
 	// Call the base class 
 	Super::BeginPlay();
+
+	if (FVRNetDormancyUtils::IsAutoDormancyEnabled(GetOwner()))
+	{
+		FVRNetDormancyUtils::StartDormancyPolling(this, FName(TEXT("PollNetDormancy")));
+	}
+
 	ReCalculateCurrentAngle();
 
 	bOriginalReplicatesMovement = bReplicateMovement;
 }
 
+void UVRLeverComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	FVRNetDormancyUtils::StopDormancyPolling(this, FName(TEXT("PollNetDormancy")));
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void UVRLeverComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
 {
 	// Call supers tick (though I don't think any of the base classes to this actually implement it)
@@ -536,6 +552,18 @@ void UVRLeverComponent::SetHeld_Implementation(UGripMotionControllerComponent *
 	}
 
 	bIsHeld = bNewIsHeld;
+
+	FVRNetDormancyUtils::WakeActor(GetOwner(), LastInteractionTime);
+
+	if (!bIsHeld && FVRNetDormancyUtils::IsAutoDormancyEnabled(GetOwner()))
+	{
+		FVRNetDormancyUtils::StartDormancyPolling(this, FName(TEXT("PollNetDormancy")));
+	}
+}
+
+bool UVRLeverComponent::PollNetDormancy()
+{
+	return FVRNetDormancyUtils::TryEnterOwnerDormancy(GetOwner());
 }
 
 /*FBPInteractionSettings UVRLeverComponent::GetInteractionSettings_Implementation()
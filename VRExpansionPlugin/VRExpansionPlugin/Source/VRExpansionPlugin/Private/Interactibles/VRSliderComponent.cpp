@@ -2,6 +2,7 @@
 
 #include "Interactibles/VRSliderComponent.h"
 #include "Net/UnrealNetwork.h"
+#include "Misc/VRNetDormancyUtils.h"
 
   //=============================================================================
 UVRSliderComponent::UVRSliderComponent(const FObjectInitializer& ObjectInitializer)
@@ -11,6 +12,8 @@ UVRSliderComponent::UVRSliderComponent(const FObjectInitializer& ObjectInitializ
 	this->PrimaryComponentTick.bStartWithTickEnabled = false;
 	PrimaryComponentTick.bCanEverTick = true;
 
+	LastInteractionTime = 0.0f;
+
 	bRepGameplayTags = false;
 
 	// Defaulting these true so that they work by default in networked environments
@@ -113,11 +116,24 @@ void UVRSliderComponent::BeginPlay()
 	// Call the base class 
 	Super::BeginPlay();
 
+	if (FVRNetDormancyUtils::IsAutoDormancyEnabled(GetOwner()))
+	{
+		FVRNetDormancyUtils::StartDormancyPolling(this, FName(TEXT("PollNetDormancy")));
+	}
+
+
 	CalculateSliderProgress();
 
 	bOriginalReplicatesMovement = bReplicateMovement;
 }
 
+void UVRSliderComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	FVRNetDormancyUtils::StopDormancyPolling(this, FName(TEXT("PollNetDormancy")));
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void UVRSliderComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
 {
 	// Call supers tick (though I don't think any of the base classes to this actually implement it)
@@ -523,6 +539,18 @@ void UVRSliderComponent::SetHeld_Implementation(UGripMotionControllerComponent *
 	}
 
 	bIsHeld = bNewIsHeld;
+
+	FVRNetDormancyUtils::WakeActor(GetOwner(), LastInteractionTime);
+
+	if (!bIsHeld && FVRNetDormancyUtils::IsAutoDormancyEnabled(GetOwner()))
+	{
+		FVRNetDormancyUtils::StartDormancyPolling(this, FName(TEXT("PollNetDormancy")));
+	}
+}
+
+bool UVRSliderComponent::PollNetDormancy()
+{
+	return FVRNetDormancyUtils::TryEnterOwnerDormancy(GetOwner());
 }
 
 /*FBPInteractionSettings UVRSliderComponent::GetInteractionSettings_Implementation()
@@ -0,0 +1,323 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/GripTickSubsystem.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+#include "Async/ParallelFor.h"
+#include "GripMotionControllerComponent.h"
+
+DECLARE_CYCLE_STAT(TEXT("GripBatchTick ~ BatchingGripTransforms"), STAT_GripBatchTick, STATGROUP_TickGrip);
+DECLARE_CYCLE_STAT(TEXT("GripBatchTick ~ ParallelGripTransforms"), STAT_GripBatchParallel, STATGROUP_TickGrip);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Batched Grips"), STAT_NumBatchedGrips, STATGROUP_TickGrip);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Parallel Grips"), STAT_NumParallelGrips, STATGROUP_TickGrip);
+
+  // CVars
+namespace GripTickSubsystemCvars
+{
+	static int32 ParallelGripTransforms = 0;
+	FAutoConsoleVariableRef CVarParallelGripTransforms(
+		TEXT("vr.ParallelGripTransforms"),
+		ParallelGripTransforms,
+		TEXT("When on (and vr.BatchGripTransforms is on), grips whose scripts are all thread safe have their world transforms evaluated in parallel.\n")
+		TEXT("0: Disable, 1: Enable"),
+		ECVF_Default);
+
+	static int32 MinParallelGrips = 8;
+	FAutoConsoleVariableRef CVarMinParallelGrips(
+		TEXT("vr.ParallelGripTransforms.MinBatchSize"),
+		MinParallelGrips,
+		TEXT("Below this many thread safe grips the evaluations stay on the game thread, dispatch would cost more than it saves.\n"),
+		ECVF_Default);
+}
+
+void FGripBatchTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Batch)
+	{
+		Batch->Tick(DeltaTime);
+	}
+}
+
+FString FGripBatchTickFunction::DiagnosticMessage()
+{
+	return TEXT("FGripBatchTickFunction");
+}
+
+void FGripTickBatch::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_GripBatchTick);
+	TGuardValue<bool> TickingGuard(bIsTicking, true);
+
+	GatheredControllers.Reset();
+	ParentTransforms.Reset();
+	DeltaTimes.Reset();
+	ParentIndices.Reset();
+	RelativeTransforms.Reset();
+	AdditionTransforms.Reset();
+	TargetTransforms.Reset();
+	Grips.Reset();
+	AsyncGrips.Reset();
+	AsyncGrippedObjects.Reset();
+
+	const bool bAllowAsync = GripTickSubsystemCvars::ParallelGripTransforms > 0;
+
+	// Gather every default transform grip across all of the controllers
+	for (int i = Controllers.Num() - 1; i >= 0; --i)
+	{
+		UGripMotionControllerComponent * Controller = Controllers[i].Get();
+
+		if (!Controller)
+		{
+			Controllers.RemoveAt(i);
+			continue;
+		}
+
+		if (!Controller->IsActive())
+			continue;
+
+		const AActor * Owner = Controller->GetOwner();
+
+		const int32 ParentIndex = ParentTransforms.Add(Controller->GetPivotTransform());
+		DeltaTimes.Add(Owner ? DeltaTime * Owner->CustomTimeDilation : DeltaTime);
+		GatheredControllers.Add(Controller);
+
+		GatherGrips(Controller, Controller->GrippedObjects, ParentIndex, bAllowAsync);
+		GatherGrips(Controller, Controller->LocallyGrippedObjects, ParentIndex, bAllowAsync);
+	}
+
+	SET_DWORD_STAT(STAT_NumBatchedGrips, Grips.Num());
+	SET_DWORD_STAT(STAT_NumParallelGrips, AsyncGrips.Num());
+
+	ComputeTargetTransforms();
+	EvaluateAsyncTransforms();
+
+	// Hand the results back, the pointers are still valid as nothing has touched the grip arrays since the gather
+	for (int32 i = 0; i < Grips.Num(); ++i)
+	{
+		Grips[i]->BatchedWorldTransform = TargetTransforms[i];
+		Grips[i]->bBatchedHasValidTransform = true;
+		Grips[i]->bBatchedForceDrop = false;
+		Grips[i]->bBatchedTickedScripts = false;
+		Grips[i]->bHasBatchedWorldTransform = true;
+	}
+
+	for (const FGripAsyncTransformEvaluation & Evaluation : AsyncGrips)
+	{
+		Evaluation.Grip->BatchedWorldTransform = Evaluation.WorldTransform;
+		Evaluation.Grip->bBatchedHasValidTransform = Evaluation.bHasValidTransform;
+		Evaluation.Grip->bBatchedForceDrop = Evaluation.bForceDrop;
+		Evaluation.Grip->bBatchedTickedScripts = true;
+		Evaluation.Grip->bHasBatchedWorldTransform = true;
+	}
+
+	// Grip arrays can change from here on (drops in grip events), don't hold onto the pointers
+	Grips.Reset();
+	AsyncGrips.Reset();
+	AsyncGrippedObjects.Reset();
+
+	// Now run the per controller collision / physics handle step in the same order as the gather
+	for (int32 ParentIndex = 0; ParentIndex < GatheredControllers.Num(); ++ParentIndex)
+	{
+		UGripMotionControllerComponent * Controller = GatheredControllers[ParentIndex].Get();
+
+		if (!Controller || !Controller->IsActive())
+			continue;
+
+		// If a previous controllers grips moved this one, throw out the batched default transforms and let it compute them itself
+		const FTransform PivotTransform = Controller->GetPivotTransform();
+		if (!PivotTransform.Equals(ParentTransforms[ParentIndex], 0.0f))
+		{
+			InvalidateMovedGrips(Controller->GrippedObjects, ParentTransforms[ParentIndex], PivotTransform);
+			InvalidateMovedGrips(Controller->LocallyGrippedObjects, ParentTransforms[ParentIndex], PivotTransform);
+		}
+
+		Controller->TickGrip(DeltaTimes[ParentIndex]);
+	}
+}
+
+void FGripTickBatch::GatherGrips(UGripMotionControllerComponent * Controller, TArray<FBPActorGripInformation> & GripArray, int32 ParentIndex, bool bAllowAsync)
+{
+	for (FBPActorGripInformation & Grip : GripArray)
+	{
+		if (Controller->IsDefaultGripWorldTransform(Grip))
+		{
+			ParentIndices.Add(ParentIndex);
+			RelativeTransforms.Add(Grip.RelativeTransform);
+			AdditionTransforms.Add(Grip.AdditionTransform);
+			Grips.Add(&Grip);
+		}
+		else if (bAllowAsync && Controller->CanEvaluateGripWorldTransformAsync(Grip))
+		{
+			bool bAlreadyInSet = false;
+			AsyncGrippedObjects.Add(Grip.GrippedObject, &bAlreadyInSet);
+
+			// Second grip on the same object is left to the normal grip tick, after the parallel pass is done
+			if (!bAlreadyInSet)
+				AsyncGrips.Emplace(Controller, &Grip, ParentIndex);
+		}
+	}
+}
+
+void FGripTickBatch::InvalidateMovedGrips(TArray<FBPActorGripInformation> & GripArray, const FTransform & OldParentTransform, const FTransform & NewParentTransform)
+{
+	for (FBPActorGripInformation & Grip : GripArray)
+	{
+		if (!Grip.bHasBatchedWorldTransform)
+			continue;
+
+		// Scripts have already been stepped for this frame (lerps, recoil), running them again would double them up.
+		// Carry their result along with the pivot instead.
+		if (Grip.bBatchedTickedScripts)
+			Grip.BatchedWorldTransform = Grip.BatchedWorldTransform.GetRelativeTransform(OldParentTransform) * NewParentTransform;
+		else
+			Grip.bHasBatchedWorldTransform = false;
+	}
+}
+
+void FGripTickBatch::ComputeTargetTransforms()
+{
+	const int32 NumGrips = Grips.Num();
+	TargetTransforms.SetNumUninitialized(NumGrips, false);
+
+	// Same as GS_Default without a secondary grip, FTransform::Multiply is vectorized on supported platforms
+	FTransform RelativeWithAddition;
+	for (int32 i = 0; i < NumGrips; ++i)
+	{
+		FTransform::Multiply(&RelativeWithAddition, &RelativeTransforms[i], &AdditionTransforms[i]);
+		FTransform::Multiply(&TargetTransforms[i], &RelativeWithAddition, &ParentTransforms[ParentIndices[i]]);
+	}
+}
+
+void FGripTickBatch::EvaluateAsyncTransforms()
+{
+	if (AsyncGrips.Num() < 1)
+		return;
+
+	SCOPE_CYCLE_COUNTER(STAT_GripBatchParallel);
+
+	// Small batches aren't worth the task dispatch, still run them through here so that the results path is the same
+	const bool bForceSingleThread = AsyncGrips.Num() < GripTickSubsystemCvars::MinParallelGrips;
+
+	ParallelFor(AsyncGrips.Num(), [this](int32 Index)
+	{
+		FGripAsyncTransformEvaluation & Evaluation = AsyncGrips[Index];
+		FBPActorGripInformation & Grip = *Evaluation.Grip;
+		FBPActorGripInformation::FGripDispatchCache & Cache = Grip.DispatchCache;
+
+		// Only touches the grip and its (thread safe) scripts, the results are applied back on the game thread
+		Evaluation.bHasValidTransform = Evaluation.Controller->GetGripWorldTransform(
+			Cache.GripScripts,
+			DeltaTimes[Evaluation.ParentIndex],
+			Evaluation.WorldTransform,
+			ParentTransforms[Evaluation.ParentIndex],
+			Grip,
+			Cache.CachedActor,
+			Cache.CachedRoot,
+			Cache.bRootHasInterface,
+			Cache.bActorHasInterface,
+			false,
+			Evaluation.bForceDrop
+		);
+	}, bForceSingleThread);
+}
+
+void UGripTickSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	OnWorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddUObject(this, &UGripTickSubsystem::OnWorldCleanup);
+}
+
+void UGripTickSubsystem::Deinitialize()
+{
+	FWorldDelegates::OnWorldCleanup.Remove(OnWorldCleanupHandle);
+
+	for (auto& WorldBatch : WorldBatches)
+	{
+		if (WorldBatch.Value.IsValid())
+			WorldBatch.Value->TickFunction.UnRegisterTickFunction();
+	}
+
+	WorldBatches.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UGripTickSubsystem::RegisterController(UGripMotionControllerComponent * Controller)
+{
+	if (!Controller)
+		return false;
+
+	UWorld * World = Controller->GetWorld();
+
+	if (!World || !World->IsGameWorld() || !World->PersistentLevel)
+		return false;
+
+	TUniquePtr<FGripTickBatch> & Batch = WorldBatches.FindOrAdd(World);
+
+	if (!Batch.IsValid())
+	{
+		Batch = MakeUnique<FGripTickBatch>();
+		Batch->TickFunction.Batch = Batch.Get();
+		Batch->TickFunction.bCanEverTick = true;
+		Batch->TickFunction.bStartWithTickEnabled = true;
+		Batch->TickFunction.bTickEvenWhenPaused = true; // Matches the controllers own tick
+		Batch->TickFunction.TickGroup = TG_PrePhysics;
+		Batch->TickFunction.RegisterTickFunction(World->PersistentLevel);
+	}
+
+	if (Batch->Controllers.Contains(Controller))
+		return true;
+
+	Batch->Controllers.Add(Controller);
+	Batch->TickFunction.AddPrerequisite(Controller, Controller->PrimaryComponentTick);
+	return true;
+}
+
+void UGripTickSubsystem::UnregisterController(UGripMotionControllerComponent * Controller)
+{
+	if (!Controller)
+		return;
+
+	UWorld * World = Controller->GetWorld();
+	TUniquePtr<FGripTickBatch> * Batch = WorldBatches.Find(World);
+
+	if (!Batch || !Batch->IsValid())
+		return;
+
+	(*Batch)->Controllers.Remove(Controller);
+	(*Batch)->TickFunction.RemovePrerequisite(Controller, Controller->PrimaryComponentTick);
+
+	// Can't tear down the batch from inside of its own tick (controller destroyed in a grip event), the world cleanup will get it
+	if ((*Batch)->Controllers.Num() < 1 && !(*Batch)->bIsTicking)
+	{
+		DestroyBatch(World);
+	}
+}
+
+int32 UGripTickSubsystem::GetNumBatchedGrips(UObject * WorldContextObject)
+{
+	UWorld * World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	TUniquePtr<FGripTickBatch> * Batch = World ? WorldBatches.Find(World) : nullptr;
+
+	return (Batch && Batch->IsValid()) ? (*Batch)->TargetTransforms.Num() : 0;
+}
+
+void UGripTickSubsystem::OnWorldCleanup(UWorld * World, bool bSessionEnded, bool bCleanupResources)
+{
+	// The tick function is registered with the persistent level, it has to go before the level does
+	DestroyBatch(World);
+}
+
+void UGripTickSubsystem::DestroyBatch(UWorld * World)
+{
+	TUniquePtr<FGripTickBatch> * Batch = WorldBatches.Find(World);
+
+	if (!Batch)
+		return;
+
+	if (Batch->IsValid())
+		(*Batch)->TickFunction.UnRegisterTickFunction();
+
+	WorldBatches.Remove(World);
+}
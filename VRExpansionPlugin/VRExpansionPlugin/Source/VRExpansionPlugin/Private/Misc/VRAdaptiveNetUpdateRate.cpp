@@ -0,0 +1,104 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/VRAdaptiveNetUpdateRate.h"
+#include "GameFramework/Actor.h"
+#include "Engine/NetConnection.h"
+#include "Engine/NetSerialization.h"
+#include "VRGlobalSettings.h"
+#include "VRBPDatatypes.h"
+
+namespace VRAdaptiveNetUpdateRate
+{
+	// Per send overhead on top of the pose itself, the bunch header and the RPC field handle come to about this much
+	static const float RPCOverheadBytes = 4.0f;
+
+	// One pose per tracked component a character sends, HMD + both hands, see FBPVRTrackedPoseFrame::EPoseBits
+	static const float PosesPerCharacter = (float)FPlatformMath::CountBits(FBPVRTrackedPoseFrame::Pose_Camera | FBPVRTrackedPoseFrame::Pose_LeftController | FBPVRTrackedPoseFrame::Pose_RightController);
+
+	// How fast the rate falls back off after a swing, rising is immediate
+	static const float RateDecaySpeed = 4.0f;
+
+	// Relative pose at the edge of a 4m x 4m play space, sizes the packed position for a typical tracked component
+	static const FVector  SizingPosition = FVector(200.0f, 200.0f, 200.0f);
+	static const FRotator SizingRotation = FRotator(30.0f, 120.0f, 45.0f);
+
+	static float PoseSendBytes[2][3] = { { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f } };
+
+	// Bytes one send of a pose costs at the reps quantization levels, measured once per level pair by running the sizing pose
+	// through the same NetSerialize the RPC uses and then read from the table
+	static float GetPoseSendBytes(const FBPVRComponentPosRep & PoseRep)
+	{
+		const int32 VectorLevel   = FMath::Clamp((int32)PoseRep.QuantizationLevel, 0, 1);
+		const int32 RotationLevel = FMath::Clamp((int32)PoseRep.RotationQuantizationLevel, 0, 2);
+
+		float & SendBytes = PoseSendBytes[VectorLevel][RotationLevel];
+
+		if (SendBytes <= 0.0f)
+		{
+			FBPVRComponentPosRep SizingRep = PoseRep;
+			SizingRep.Position = SizingPosition;
+			SizingRep.Rotation = SizingRotation;
+
+			FNetBitWriter Writer(nullptr, 256);
+			bool bSuccess = true;
+			SizingRep.NetSerialize(Writer, nullptr, bSuccess);
+
+			SendBytes = FMath::DivideAndRoundUp(Writer.GetNumBits(), (int64)8) + RPCOverheadBytes;
+		}
+
+		return SendBytes;
+	}
+}
+
+float FVRAdaptiveNetUpdateRate::Update(const AActor * Owner, float DeltaTime, const FBPVRComponentPosRep & PoseRep, const FVector & Position, const FRotator & Rotation, float MaxRate)
+{
+	const UVRGlobalSettings * VRSettings = GetDefault<UVRGlobalSettings>();
+	const FQuat RotationQuat = Rotation.Quaternion();
+
+	if (!VRSettings->bUseAdaptiveNetUpdateRate || DeltaTime <= 0.0f)
+	{
+		LastPosition = Position;
+		LastRotation = RotationQuat;
+		bHasLastPose = true;
+		EffectiveRate = MaxRate;
+		return EffectiveRate;
+	}
+
+	const float MinRate = FMath::Min(VRSettings->AdaptiveNetUpdateMinRate, MaxRate);
+	float MotionAlpha = 1.0f;
+
+	if (bHasLastPose)
+	{
+		const float LinearVelocity = FVector::Dist(Position, LastPosition) / DeltaTime;
+		const float AngularVelocity = FMath::RadiansToDegrees(RotationQuat.AngularDistance(LastRotation)) / DeltaTime;
+
+		const float LinearAlpha = VRSettings->AdaptiveNetUpdateLinearVelocity > 0.0f ? LinearVelocity / VRSettings->AdaptiveNetUpdateLinearVelocity : 1.0f;
+		const float AngularAlpha = VRSettings->AdaptiveNetUpdateAngularVelocity > 0.0f ? AngularVelocity / VRSettings->AdaptiveNetUpdateAngularVelocity : 1.0f;
+
+		MotionAlpha = FMath::Clamp(FMath::Max(LinearAlpha, AngularAlpha), 0.0f, 1.0f);
+	}
+
+	LastPosition = Position;
+	LastRotation = RotationQuat;
+	bHasLastPose = true;
+
+	float TargetRate = FMath::Lerp(MinRate, MaxRate, MotionAlpha);
+
+	// Keep the characters poses within their share of the connection
+	if (UNetConnection * NetConnection = Owner ? Owner->GetNetConnection() : nullptr)
+	{
+		if (NetConnection->CurrentNetSpeed > 0 && VRSettings->AdaptiveNetUpdateBandwidthFraction > 0.0f)
+		{
+			const float BytesPerPoseSend = VRAdaptiveNetUpdateRate::GetPoseSendBytes(PoseRep);
+			const float BudgetRate = (NetConnection->CurrentNetSpeed * VRSettings->AdaptiveNetUpdateBandwidthFraction) / (BytesPerPoseSend * VRAdaptiveNetUpdateRate::PosesPerCharacter);
+			TargetRate = FMath::Min(TargetRate, FMath::Max(BudgetRate, MinRate));
+		}
+	}
+
+	if (TargetRate >= EffectiveRate)
+		EffectiveRate = TargetRate;
+	else
+		EffectiveRate = FMath::FInterpTo(EffectiveRate, TargetRate, DeltaTime, VRAdaptiveNetUpdateRate::RateDecaySpeed);
+
+	return EffectiveRate;
+}
@@ -0,0 +1,173 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/VRNetDormancyUtils.h"
+#include "GameFramework/Actor.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/Engine.h"
+#include "Misc/BucketUpdateSubsystem.h"
+#include "VRGlobalSettings.h"
+#include "GripMotionControllerComponent.h"
+#include "Interactibles/VRDialComponent.h"
+#include "Interactibles/VRLeverComponent.h"
+#include "Interactibles/VRSliderComponent.h"
+#include "Grippables/GrippableActor.h"
+#include "Grippables/GrippableStaticMeshActor.h"
+#include "Grippables/GrippableSkeletalMeshActor.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Auto Dormancy Entered"), STAT_AutoDormancyEntered, STATGROUP_TickGrip);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Auto Dormancy Woken"), STAT_AutoDormancyWoken, STATGROUP_TickGrip);
+
+namespace VRNetDormancyUtils
+{
+	template<class InteractibleType>
+	static bool GatherInteractibleState(UActorComponent * Component, bool & bIsBusy, float & LastInteractionTime)
+	{
+		InteractibleType * Interactible = Cast<InteractibleType>(Component);
+
+		if (!Interactible)
+			return false;
+
+		// Still ticking means it is lerping back or carrying momentum
+		bIsBusy |= Interactible->bIsHeld || Interactible->IsComponentTickEnabled();
+		LastInteractionTime = FMath::Max(LastInteractionTime, Interactible->LastInteractionTime);
+		return true;
+	}
+
+	template<class GrippableType>
+	static bool GatherGrippableState(AActor * Actor, bool & bIsBusy, float & LastInteractionTime)
+	{
+		GrippableType * Grippable = Cast<GrippableType>(Actor);
+
+		if (!Grippable)
+			return false;
+
+		// Client auth throws need to keep replicating until they settle
+		bIsBusy |= Grippable->VRGripInterfaceSettings.bIsHeld || Grippable->ClientAuthReplicationData.bIsCurrentlyClientAuth;
+		LastInteractionTime = FMath::Max(LastInteractionTime, Grippable->LastInteractionTime);
+		return true;
+	}
+}
+
+bool FVRNetDormancyUtils::IsAutoDormancyEnabled(const AActor * Actor)
+{
+	if (!Actor || !GetDefault<UVRGlobalSettings>()->bUseAutoNetDormancy)
+		return false;
+
+	// Only the server controls dormancy, and there is nothing to save without replication
+	return Actor->GetIsReplicated() && Actor->HasAuthority() && Actor->GetNetMode() != NM_Standalone && Actor->GetNetMode() != NM_Client;
+}
+
+void FVRNetDormancyUtils::WakeActor(AActor * Actor, float & LastInteractionTime)
+{
+	if (!IsAutoDormancyEnabled(Actor))
+		return;
+
+	if (UWorld * World = Actor->GetWorld())
+	{
+		LastInteractionTime = World->GetTimeSeconds();
+	}
+
+	if (Actor->NetDormancy > DORM_Awake)
+	{
+		Actor->SetNetDormancy(DORM_Awake);
+		INC_DWORD_STAT(STAT_AutoDormancyWoken);
+	}
+}
+
+void FVRNetDormancyUtils::StartDormancyPolling(UObject * PollingObject, FName FunctionName)
+{
+	const UVRGlobalSettings * VRSettings = GetDefault<UVRGlobalSettings>();
+
+	if (!PollingObject || !VRSettings->bUseAutoNetDormancy)
+		return;
+
+	// The subsystem automatically removes entries with the same function signature so its safe to just always add here
+	GEngine->GetEngineSubsystem<UBucketUpdateSubsystem>()->AddObjectToBucket(FMath::Max(VRSettings->AutoDormancyCheckRate, 1), PollingObject, FunctionName);
+}
+
+void FVRNetDormancyUtils::StopDormancyPolling(UObject * PollingObject, FName FunctionName)
+{
+	if (!PollingObject || !GEngine)
+		return;
+
+	GEngine->GetEngineSubsystem<UBucketUpdateSubsystem>()->RemoveObjectFromBucketByFunctionName(PollingObject, FunctionName);
+}
+
+bool FVRNetDormancyUtils::TryEnterDormancy(AActor * Actor, bool bIsBusy, float LastInteractionTime)
+{
+	if (!IsAutoDormancyEnabled(Actor))
+		return false;
+
+	UPrimitiveComponent * RootPrim = Cast<UPrimitiveComponent>(Actor->GetRootComponent());
+	const bool bPhysicsAwake = RootPrim && RootPrim->IsSimulatingPhysics() && RootPrim->RigidBodyIsAwake();
+
+	// Keep watching dormant objects, something on the server (a hit, an explosion, a held object) can knock them
+	// loose and their movement has to replicate again until they settle
+	if (Actor->NetDormancy > DORM_Awake)
+	{
+		if (bPhysicsAwake)
+		{
+			Actor->SetNetDormancy(DORM_Awake);
+			INC_DWORD_STAT(STAT_AutoDormancyWoken);
+		}
+
+		return true;
+	}
+
+	if (bIsBusy)
+		return true;
+
+	UWorld * World = Actor->GetWorld();
+
+	if (!World || (World->GetTimeSeconds() - LastInteractionTime) < GetDefault<UVRGlobalSettings>()->AutoDormancyRestTime)
+		return true;
+
+	// Still settling, thrown objects keep simulating for a while after release
+	if (bPhysicsAwake)
+		return true;
+
+	Actor->SetNetDormancy(DORM_DormantAll);
+	INC_DWORD_STAT(STAT_AutoDormancyEntered);
+	return true;
+}
+
+bool FVRNetDormancyUtils::TryEnterOwnerDormancy(AActor * Owner)
+{
+	if (!Owner)
+		return false;
+
+	bool bIsBusy = false;
+	float LastInteractionTime = 0.0f;
+
+	if (!VRNetDormancyUtils::GatherGrippableState<AGrippableActor>(Owner, bIsBusy, LastInteractionTime) &&
+		!VRNetDormancyUtils::GatherGrippableState<AGrippableStaticMeshActor>(Owner, bIsBusy, LastInteractionTime))
+	{
+		VRNetDormancyUtils::GatherGrippableState<AGrippableSkeletalMeshActor>(Owner, bIsBusy, LastInteractionTime);
+	}
+
+	for (UActorComponent * Component : Owner->GetComponents())
+	{
+		if (VRNetDormancyUtils::GatherInteractibleState<UVRDialComponent>(Component, bIsBusy, LastInteractionTime) ||
+			VRNetDormancyUtils::GatherInteractibleState<UVRLeverComponent>(Component, bIsBusy, LastInteractionTime))
+			continue;
+
+		VRNetDormancyUtils::GatherInteractibleState<UVRSliderComponent>(Component, bIsBusy, LastInteractionTime);
+	}
+
+	return TryEnterDormancy(Owner, bIsBusy, LastInteractionTime);
+}
+
+float FVRNetDormancyUtils::GetNetPriorityScale(const AActor * Actor, float LastInteractionTime)
+{
+	const UVRGlobalSettings * VRSettings = GetDefault<UVRGlobalSettings>();
+
+	if (!Actor || !VRSettings->bUseAutoNetDormancy || VRSettings->RecentInteractionPriorityTime <= 0.0f)
+		return 1.0f;
+
+	const UWorld * World = Actor->GetWorld();
+
+	if (!World || (World->GetTimeSeconds() - LastInteractionTime) > VRSettings->RecentInteractionPriorityTime)
+		return 1.0f;
+
+	return FMath::Max(VRSettings->RecentInteractionPriorityScale, 1.0f);
+}
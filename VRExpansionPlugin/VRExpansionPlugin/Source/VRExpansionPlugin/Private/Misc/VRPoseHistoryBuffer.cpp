@@ -0,0 +1,49 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/VRPoseHistoryBuffer.h"
+
+void FVRPoseHistoryBuffer::Record(float Time, const FTransform & Pose, int32 MaxSamples)
+{
+	MaxSamples = FMath::Max(MaxSamples, 2);
+
+	// Capacity changed (settings edited) after wrapping, start over rather than re-ordering
+	if (Samples.Num() > MaxSamples || (Head != 0 && Samples.Num() < MaxSamples))
+	{
+		Reset();
+	}
+
+	FPoseSample Sample;
+	Sample.Time     = Time;
+	Sample.Location = Pose.GetLocation();
+
+	if (Samples.Num() < MaxSamples)
+	{
+		Samples.Add(Sample);
+		return;
+	}
+
+	Samples[Head] = Sample;
+	Head = (Head + 1) % Samples.Num();
+}
+
+bool FVRPoseHistoryBuffer::IsLocationReachable(const FVector & Location, float StartTime, float EndTime, float BaseRadius, float Speed) const
+{
+	// Newest first, most throws are checked right after release
+	for (int32 Index = Samples.Num() - 1; Index >= 0; --Index)
+	{
+		const FPoseSample & Sample = GetSample(Index);
+
+		if (Sample.Time > EndTime)
+			continue;
+
+		if (Sample.Time < StartTime)
+			break;
+
+		const float AllowedDistance = BaseRadius + Speed * (EndTime - Sample.Time);
+
+		if (FVector::DistSquared(Sample.Location, Location) <= FMath::Square(AllowedDistance))
+			return true;
+	}
+
+	return false;
+}
@@ -0,0 +1,158 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/VRPoseSnapshotBuffer.h"
+#include "Engine/World.h"
+#include "VRBPDatatypes.h"
+#include "VRGlobalSettings.h"
+#include "GripMotionControllerComponent.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pose Snapshots Buffered"), STAT_PoseSnapshotsBuffered, STATGROUP_TickGrip);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pose Snapshot Underruns"), STAT_PoseSnapshotUnderruns, STATGROUP_TickGrip);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pose Snapshot Extrapolated Samples"), STAT_PoseSnapshotExtrapolatedSamples, STATGROUP_TickGrip);
+
+namespace VRPoseSnapshotBuffer
+{
+	// How fast the estimated send interval follows the measured time between arrivals
+	static const float IntervalSmoothing = 0.1f;
+
+	// How much of the difference between the predicted send time and the arrival time is corrected per snapshot,
+	// low enough that jitter averages out but the stamps can't drift away from the arrivals over time
+	static const float ArrivalCorrection = 0.05f;
+}
+
+bool FVRPoseSnapshotBuffer::AddSnapshot(const UWorld * World, const FBPVRComponentPosRep & NewPose)
+{
+	const UVRGlobalSettings * VRSettings = GetDefault<UVRGlobalSettings>();
+
+	// The server keeps the old smoothing, playing back in the past there would add the delay to everything it simulates
+	if (!World || World->GetNetMode() != NM_Client || !VRSettings->bUsePoseSnapshotBuffer)
+	{
+		Reset();
+		return false;
+	}
+
+	const float ArrivalTime = World->GetRealTimeSeconds();
+
+	FPoseSnapshot Snapshot;
+	Snapshot.Time     = ArrivalTime;
+	Snapshot.Position = NewPose.Position;
+	Snapshot.Rotation = NewPose.Rotation.Quaternion();
+
+	if (Snapshots.Num() > 0)
+	{
+		const float ArrivalDelta = ArrivalTime - LastArrivalTime;
+
+		EstimatedSendInterval = EstimatedSendInterval > 0.0f ? FMath::Lerp(EstimatedSendInterval, ArrivalDelta, VRPoseSnapshotBuffer::IntervalSmoothing) : ArrivalDelta;
+
+		// Stamp off of the expected send time instead of the arrival, two reps landing in the same frame still get their own spacing
+		const float PredictedTime = Snapshots.Last().Time + FMath::Max(EstimatedSendInterval, KINDA_SMALL_NUMBER);
+		Snapshot.Time = FMath::Lerp(PredictedTime, ArrivalTime, VRPoseSnapshotBuffer::ArrivalCorrection);
+
+		// Stalled or the estimate ran off, start over from the arrival time
+		if (FMath::Abs(ArrivalTime - Snapshot.Time) > FMath::Max(VRSettings->PoseSnapshotInterpolationDelay, KINDA_SMALL_NUMBER))
+		{
+			Snapshot.Time = ArrivalTime;
+		}
+
+		Snapshot.Time = FMath::Max(Snapshot.Time, Snapshots.Last().Time + KINDA_SMALL_NUMBER);
+	}
+
+	LastArrivalTime = ArrivalTime;
+
+	// Only drop snapshots that playback has already moved past (keeping the one it interpolates from),
+	// the buffer size is just an upper bound for senders far faster than the delay needs.
+	const float RenderTime   = ArrivalTime - VRSettings->PoseSnapshotInterpolationDelay;
+	const int32 MaxSnapshots = FMath::Max(VRSettings->PoseSnapshotBufferSize, 2);
+
+	int32 NumExpired = 0;
+	while (NumExpired + 1 < Snapshots.Num() && Snapshots[NumExpired + 1].Time <= RenderTime)
+		++NumExpired;
+
+	NumExpired = FMath::Max(NumExpired, Snapshots.Num() - MaxSnapshots + 1);
+
+	if (NumExpired > 0)
+		Snapshots.RemoveAt(0, NumExpired, false);
+
+	Snapshots.Add(Snapshot);
+	return true;
+}
+
+bool FVRPoseSnapshotBuffer::Sample(const UWorld * World, FVector & OutPosition, FRotator & OutRotation)
+{
+	if (!World || Snapshots.Num() == 0)
+		return false;
+
+	INC_DWORD_STAT_BY(STAT_PoseSnapshotsBuffered, Snapshots.Num());
+
+	const UVRGlobalSettings * VRSettings = GetDefault<UVRGlobalSettings>();
+	const float RenderTime = World->GetRealTimeSeconds() - VRSettings->PoseSnapshotInterpolationDelay;
+
+	// Still filling, hold the oldest pose
+	if (RenderTime <= Snapshots[0].Time)
+	{
+		OutPosition = Snapshots[0].Position;
+		OutRotation = Snapshots[0].Rotation.Rotator();
+		return true;
+	}
+
+	const FPoseSnapshot & Newest = Snapshots.Last();
+
+	if (RenderTime < Newest.Time)
+	{
+		bIsUnderrun = false;
+
+		int32 FromIndex = 0;
+		while (Snapshots[FromIndex + 1].Time <= RenderTime)
+			++FromIndex;
+
+		const FPoseSnapshot & From = Snapshots[FromIndex];
+		const FPoseSnapshot & To = Snapshots[FromIndex + 1];
+		const float Alpha = (RenderTime - From.Time) / FMath::Max(To.Time - From.Time, KINDA_SMALL_NUMBER);
+
+		OutPosition = FMath::Lerp(From.Position, To.Position, Alpha);
+		OutRotation = FQuat::Slerp(From.Rotation, To.Rotation, Alpha).Rotator();
+
+		// Nothing will sample before From again
+		if (FromIndex > 0)
+			Snapshots.RemoveAt(0, FromIndex, false);
+
+		return true;
+	}
+
+	// Ran past the newest pose, the next one is late or lost
+	if (!bIsUnderrun)
+	{
+		bIsUnderrun = true;
+		INC_DWORD_STAT(STAT_PoseSnapshotUnderruns);
+	}
+
+	OutPosition = Newest.Position;
+	OutRotation = Newest.Rotation.Rotator();
+
+	const float ExtrapolationTime = FMath::Min(RenderTime - Newest.Time, VRSettings->PoseSnapshotMaxExtrapolationTime);
+
+	if (Snapshots.Num() < 2 || ExtrapolationTime <= 0.0f)
+		return true;
+
+	const FPoseSnapshot & Previous = Snapshots[Snapshots.Num() - 2];
+	const float SnapshotDelta = Newest.Time - Previous.Time;
+
+	if (SnapshotDelta <= KINDA_SMALL_NUMBER)
+		return true;
+
+	INC_DWORD_STAT(STAT_PoseSnapshotExtrapolatedSamples);
+
+	const float Scale = ExtrapolationTime / SnapshotDelta;
+	OutPosition = Newest.Position + (Newest.Position - Previous.Position) * Scale;
+
+	FVector Axis;
+	float Angle;
+	(Newest.Rotation * Previous.Rotation.Inverse()).GetNormalized().ToAxisAndAngle(Axis, Angle);
+
+	// Take the short way around
+	if (Angle > PI)
+		Angle -= 2.0f * PI;
+
+	OutRotation = (FQuat(Axis, Angle * Scale) * Newest.Rotation).Rotator();
+	return true;
+}
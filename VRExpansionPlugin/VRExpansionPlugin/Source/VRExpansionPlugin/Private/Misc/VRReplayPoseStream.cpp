@@ -0,0 +1,233 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/VRReplayPoseStream.h"
+#include "Serialization/BitWriter.h"
+#include "VRGlobalSettings.h"
+#include "GripMotionControllerComponent.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Replay Pose Stream Bytes"), STAT_ReplayPoseStreamBytes, STATGROUP_TickGrip);
+
+namespace VRReplayPoseStream
+{
+	// Positions are stored in 1/10th of a cm
+	static const float PositionScale = 10.0f;
+
+	// More than this is a corrupt stream, 255hz for a full second is already excessive
+	static const uint32 MaxSamplesPerBatch = 256;
+
+	// Batches kept for playback, enough to bridge the gap between two while the newest is arriving
+	static const int32 MaxPlaybackBatches = 3;
+
+	FORCEINLINE uint32 ZigZag(int32 Value)
+	{
+		return (uint32)((Value << 1) ^ (Value >> 31));
+	}
+
+	FORCEINLINE int32 UnZigZag(uint32 Value)
+	{
+		return (int32)(Value >> 1) ^ -(int32)(Value & 1);
+	}
+
+	FORCEINLINE void SerializeDelta(FArchive & Ar, int32 & Value, int32 Previous)
+	{
+		uint32 Packed = Ar.IsSaving() ? ZigZag(Value - Previous) : 0;
+		Ar.SerializeIntPacked(Packed);
+
+		if (Ar.IsLoading())
+			Value = Previous + UnZigZag(Packed);
+	}
+
+	FORCEINLINE void SerializeRotationDelta(FArchive & Ar, uint16 & Value, uint16 Previous)
+	{
+		// Wraps, so a rotation crossing 180 degrees stays a small delta
+		int32 Delta = Ar.IsSaving() ? (int32)(int16)(Value - Previous) : 0;
+
+		uint32 Packed = ZigZag(Delta);
+		Ar.SerializeIntPacked(Packed);
+
+		if (Ar.IsLoading())
+			Value = (uint16)(Previous + UnZigZag(Packed));
+	}
+
+	FORCEINLINE void Interpolate(const FVRReplayPoseSample & From, const FVRReplayPoseSample & To, float Alpha, FVRReplayPoseSample & OutSample)
+	{
+		for (int32 PoseIndex = 0; PoseIndex < FVRReplayPoseSample::NumPoses; ++PoseIndex)
+		{
+			OutSample.Positions[PoseIndex] = FMath::Lerp(From.Positions[PoseIndex], To.Positions[PoseIndex], Alpha);
+			OutSample.Rotations[PoseIndex] = FQuat::Slerp(From.Rotations[PoseIndex].Quaternion(), To.Rotations[PoseIndex].Quaternion(), Alpha).Rotator();
+		}
+	}
+}
+
+bool FVRReplayPoseBatch::Sample(float Time, FVRReplayPoseSample & OutSample) const
+{
+	if (Samples.Num() < 1)
+		return false;
+
+	const float SampleIndex = FMath::Clamp((Time - StartTime) * FMath::Max<uint8>(SampleRate, 1), 0.0f, (float)(Samples.Num() - 1));
+	const int32 FromIndex = FMath::FloorToInt(SampleIndex);
+	const int32 ToIndex = FMath::Min(FromIndex + 1, Samples.Num() - 1);
+
+	VRReplayPoseStream::Interpolate(Samples[FromIndex], Samples[ToIndex], SampleIndex - FromIndex, OutSample);
+	return true;
+}
+
+bool FVRReplayPoseBatch::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+{
+	bOutSuccess = true;
+
+	Ar << BatchId;
+	Ar << StartTime;
+	Ar << SampleRate;
+
+	uint32 NumSamples = Samples.Num();
+	Ar.SerializeIntPacked(NumSamples);
+
+	if (Ar.IsLoading())
+	{
+		if (NumSamples > VRReplayPoseStream::MaxSamplesPerBatch)
+		{
+			Samples.Reset();
+			bOutSuccess = false;
+			return false;
+		}
+
+		Samples.SetNumUninitialized(NumSamples);
+	}
+
+	// Quantized values of the previous sample, the keyframe is a delta off of zero
+	int32  PrevPosition[FVRReplayPoseSample::NumPoses][3] = {};
+	uint16 PrevRotation[FVRReplayPoseSample::NumPoses][3] = {};
+
+	for (FVRReplayPoseSample & PoseSample : Samples)
+	{
+		for (int32 PoseIndex = 0; PoseIndex < FVRReplayPoseSample::NumPoses; ++PoseIndex)
+		{
+			FVector & Position = PoseSample.Positions[PoseIndex];
+			FRotator & Rotation = PoseSample.Rotations[PoseIndex];
+
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				int32 QuantizedPosition = Ar.IsSaving() ? FMath::RoundToInt(Position[Axis] * VRReplayPoseStream::PositionScale) : 0;
+				VRReplayPoseStream::SerializeDelta(Ar, QuantizedPosition, PrevPosition[PoseIndex][Axis]);
+				PrevPosition[PoseIndex][Axis] = QuantizedPosition;
+
+				if (Ar.IsLoading())
+					Position[Axis] = QuantizedPosition / VRReplayPoseStream::PositionScale;
+			}
+
+			float * RotationAxes[3] = { &Rotation.Pitch, &Rotation.Yaw, &Rotation.Roll };
+
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				uint16 QuantizedRotation = Ar.IsSaving() ? FRotator::CompressAxisToShort(*RotationAxes[Axis]) : 0;
+				VRReplayPoseStream::SerializeRotationDelta(Ar, QuantizedRotation, PrevRotation[PoseIndex][Axis]);
+				PrevRotation[PoseIndex][Axis] = QuantizedRotation;
+
+				if (Ar.IsLoading())
+					*RotationAxes[Axis] = FRotator::DecompressAxisFromShort(QuantizedRotation);
+			}
+		}
+	}
+
+	return bOutSuccess;
+}
+
+bool FVRReplayPoseStream::Record(float ReplayTime, const FVRReplayPoseSample & NewSample, FVRReplayPoseBatch & OutBatch)
+{
+	const UVRGlobalSettings * VRSettings = GetDefault<UVRGlobalSettings>();
+	const uint8 SampleRate = (uint8)FMath::Clamp(VRSettings->ReplayPoseSampleRate, 1, 255);
+
+	// Replay restarted or scrubbed while recording (client replays)
+	if (ReplayTime < NextSampleTime - 1.0f)
+	{
+		RecordingBatch.Samples.Reset();
+		NextSampleTime = 0.0f;
+	}
+
+	if (ReplayTime < NextSampleTime)
+		return false;
+
+	if (RecordingBatch.Samples.Num() < 1)
+	{
+		RecordingBatch.StartTime = ReplayTime;
+		RecordingBatch.SampleRate = SampleRate;
+	}
+
+	RecordingBatch.Samples.Add(NewSample);
+
+	// Fixed rate off of the keyframe, playback rebuilds the sample times from it
+	NextSampleTime = RecordingBatch.StartTime + (RecordingBatch.Samples.Num() / (float)RecordingBatch.SampleRate);
+
+	const int32 SamplesPerBatch = FMath::Clamp(FMath::RoundToInt(VRSettings->ReplayPoseBatchLength * RecordingBatch.SampleRate), 1, (int32)VRReplayPoseStream::MaxSamplesPerBatch);
+
+	if (RecordingBatch.Samples.Num() < SamplesPerBatch)
+		return false;
+
+	RecordingBatch.BatchId = NextBatchId++;
+	OutBatch = RecordingBatch;
+	RecordingBatch.Samples.Reset();
+
+#if STATS
+	FBitWriter SizeWriter(0, true);
+	bool bSizeSuccess = true;
+	OutBatch.NetSerialize(SizeWriter, nullptr, bSizeSuccess);
+	INC_DWORD_STAT_BY(STAT_ReplayPoseStreamBytes, SizeWriter.GetNumBytes());
+#endif
+
+	return true;
+}
+
+void FVRReplayPoseStream::AddBatch(const FVRReplayPoseBatch & NewBatch)
+{
+	if (NewBatch.Samples.Num() < 1)
+		return;
+
+	// Scrubbed backwards, start over from the checkpoints batch
+	if (PlaybackBatches.Num() > 0 && NewBatch.StartTime <= PlaybackBatches.Last().StartTime)
+	{
+		PlaybackBatches.Reset();
+	}
+
+	PlaybackBatches.Add(NewBatch);
+
+	if (PlaybackBatches.Num() > VRReplayPoseStream::MaxPlaybackBatches)
+	{
+		PlaybackBatches.RemoveAt(0, PlaybackBatches.Num() - VRReplayPoseStream::MaxPlaybackBatches, false);
+	}
+}
+
+bool FVRReplayPoseStream::Sample(float ReplayTime, FVRReplayPoseSample & OutSample) const
+{
+	if (PlaybackBatches.Num() < 1)
+		return false;
+
+	for (int32 BatchIndex = 0; BatchIndex < PlaybackBatches.Num(); ++BatchIndex)
+	{
+		const FVRReplayPoseBatch & Batch = PlaybackBatches[BatchIndex];
+
+		if (ReplayTime < Batch.StartTime)
+		{
+			// In the gap between two batches, bridge from the end of the last one
+			if (BatchIndex > 0)
+			{
+				const FVRReplayPoseBatch & PrevBatch = PlaybackBatches[BatchIndex - 1];
+				const float GapLength = Batch.StartTime - PrevBatch.GetEndTime();
+				const float Alpha = GapLength > KINDA_SMALL_NUMBER ? FMath::Clamp((ReplayTime - PrevBatch.GetEndTime()) / GapLength, 0.0f, 1.0f) : 1.0f;
+
+				VRReplayPoseStream::Interpolate(PrevBatch.Samples.Last(), Batch.Samples[0], Alpha, OutSample);
+				return true;
+			}
+
+			return Batch.Sample(ReplayTime, OutSample);
+		}
+
+		if (ReplayTime <= Batch.GetEndTime())
+		{
+			return Batch.Sample(ReplayTime, OutSample);
+		}
+	}
+
+	// Past the newest batch, hold its last pose
+	return PlaybackBatches.Last().Sample(ReplayTime, OutSample);
+}
@@ -83,6 +83,15 @@ void UReplicatedVRCameraComponent::GetLifetimeReplicatedProps(TArray< class FLif
 	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeScale3D , false);
 }*/
 
+void UReplicatedVRCameraComponent::PreReplication(IRepChangedPropertyTracker & ChangedPropertyTracker)
+{
+	Super::PreReplication(ChangedPropertyTracker);
+
+	// The owning character records a compact pose stream into replays instead
+	const bool bSkipInReplay = ChangedPropertyTracker.IsReplay() && GetDefault<UVRGlobalSettings>()->bUseReplayPoseStream && Cast<AVRBaseCharacter>(GetOwner()) != nullptr;
+	DOREPLIFETIME_ACTIVE_OVERRIDE(UReplicatedVRCameraComponent, ReplicatedCameraTransform, !bSkipInReplay);
+}
+
 void UReplicatedVRCameraComponent::Server_SendCameraTransform_Implementation(FBPVRComponentPosRep NewTransform)
 {
 	// Store new transform and trigger OnRep_Function.
@@ -156,12 +165,15 @@ void UReplicatedVRCameraComponent::TickComponent(float DeltaTime, enum ELevelTic
 		// Send changes
 		if (bReplicates)
 		{
+			// Runs every tick so that it sees the full motion between sends
+			const float SendRate = AdaptiveNetUpdateRate.Update(GetOwner(), DeltaTime, ReplicatedCameraTransform, this->RelativeLocation, this->RelativeRotation, NetUpdateRate);
+
 			// Don't rep if no changes
 			if (!this->RelativeLocation.Equals(ReplicatedCameraTransform.Position) ||  !this->RelativeRotation.Equals(ReplicatedCameraTransform.Rotation))
 			{
 				NetUpdateCount += DeltaTime;
 
-				if (NetUpdateCount >= (1.0f / NetUpdateRate))
+				if (NetUpdateCount >= (1.0f / SendRate))
 				{
 					NetUpdateCount = 0.0f;
 
@@ -172,7 +184,11 @@ void UReplicatedVRCameraComponent::TickComponent(float DeltaTime, enum ELevelTic
 					{
 						AVRBaseCharacter * OwningChar = Cast<AVRBaseCharacter>(GetOwner());
 
-						if (ServerRPC_SendTransformFunc != nullptr && OwningChar != nullptr)
+						if (OwningChar != nullptr && OwningChar->StageTrackedPose(FBPVRTrackedPoseFrame::Pose_Camera, ReplicatedCameraTransform))
+						{
+							// Sent with the controllers in the characters tracked pose frame
+						}
+						else if (ServerRPC_SendTransformFunc != nullptr && OwningChar != nullptr)
 						{
 							(OwningChar->* (ServerRPC_SendTransformFunc))(ReplicatedCameraTransform);
 						}
@@ -189,7 +205,17 @@ void UReplicatedVRCameraComponent::TickComponent(float DeltaTime, enum ELevelTic
 	}
 	else
 	{
-		if (bLerpingPosition)
+		if (ReplicatedPoseBuffer.IsActive())
+		{
+			FVector  BufferedPosition;
+			FRotator BufferedRotation;
+
+			if (ReplicatedPoseBuffer.Sample(GetWorld(), BufferedPosition, BufferedRotation))
+			{
+				SetRelativeLocationAndRotation(BufferedPosition, BufferedRotation);
+			}
+		}
+		else if (bLerpingPosition)
 		{
 			NetUpdateCount += DeltaTime;
 
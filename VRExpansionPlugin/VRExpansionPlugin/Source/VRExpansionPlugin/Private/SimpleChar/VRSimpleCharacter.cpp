@@ -118,17 +118,17 @@ bool AVRSimpleCharacter::TeleportTo(const FVector& DestLocation, const FRotator&
 	return bTeleportSucceeded;
 }
 
-bool AVRSimpleCharacter::ServerMoveVR_Validate(float TimeStamp, FVector_NetQuantize10 InAccel, FVector_NetQuantize100 ClientLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantize100 LFDiff, uint8 MoveFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
+bool AVRSimpleCharacter::ServerMoveVR_Validate(float TimeStamp, FVector_NetQuantize10 InAccel, FVector_NetQuantize100 ClientLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantizeSparse100 LFDiff, uint8 MoveFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
 {
 	return ((UVRSimpleCharacterMovementComponent*)GetCharacterMovement())->ServerMoveVR_Validate(TimeStamp, InAccel, ClientLoc, ConditionalReps, LFDiff, MoveFlags, MoveReps, ClientMovementMode);
 }
 
-bool AVRSimpleCharacter::ServerMoveVRDual_Validate(float TimeStamp0, FVector_NetQuantize10 InAccel0, uint8 PendingFlags, uint32 View0, FVRConditionalMoveRep OldConditionalReps, FVector_NetQuantize100 OldLFDiff, float TimeStamp, FVector_NetQuantize10 InAccel, FVector_NetQuantize100 ClientLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantize100 LFDiff, uint8 NewFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
+bool AVRSimpleCharacter::ServerMoveVRDual_Validate(float TimeStamp0, FVector_NetQuantize10 InAccel0, uint8 PendingFlags, uint32 View0, FVRConditionalMoveRep OldConditionalReps, FVector_NetQuantizeSparse100 OldLFDiff, float TimeStamp, FVector_NetQuantize10 InAccel, FVector_NetQuantize100 ClientLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantizeSparse100 LFDiff, uint8 NewFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
 {
 	return ((UVRSimpleCharacterMovementComponent*)GetCharacterMovement())->ServerMoveVRDual_Validate(TimeStamp0, InAccel0, PendingFlags, View0, OldConditionalReps, OldLFDiff, TimeStamp, InAccel, ClientLoc, ConditionalReps, LFDiff, NewFlags, MoveReps, ClientMovementMode);
 }
 
-bool AVRSimpleCharacter::ServerMoveVRDualHybridRootMotion_Validate(float TimeStamp0, FVector_NetQuantize10 InAccel0, uint8 PendingFlags, uint32 View0, FVRConditionalMoveRep OldConditionalReps, FVector_NetQuantize100 OldLFDiff, float TimeStamp, FVector_NetQuantize10 InAccel, FVector_NetQuantize100 ClientLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantize100 LFDiff, uint8 NewFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
+bool AVRSimpleCharacter::ServerMoveVRDualHybridRootMotion_Validate(float TimeStamp0, FVector_NetQuantize10 InAccel0, uint8 PendingFlags, uint32 View0, FVRConditionalMoveRep OldConditionalReps, FVector_NetQuantizeSparse100 OldLFDiff, float TimeStamp, FVector_NetQuantize10 InAccel, FVector_NetQuantize100 ClientLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantizeSparse100 LFDiff, uint8 NewFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
 {
 	return ((UVRSimpleCharacterMovementComponent*)GetCharacterMovement())->ServerMoveVRDualHybridRootMotion_Validate(TimeStamp0, InAccel0, PendingFlags, View0, OldConditionalReps, OldLFDiff, TimeStamp, InAccel, ClientLoc, ConditionalReps, LFDiff, NewFlags, MoveReps, ClientMovementMode);
 }
@@ -139,12 +139,12 @@ void AVRSimpleCharacter::ServerMoveVRDual_Implementation(
 	uint8 PendingFlags,
 	uint32 View0,
 	FVRConditionalMoveRep OldConditionalReps,
-	FVector_NetQuantize100 OldLFDiff,
+	FVector_NetQuantizeSparse100 OldLFDiff,
 	float TimeStamp,
 	FVector_NetQuantize10 InAccel,
 	FVector_NetQuantize100 ClientLoc,
 	FVRConditionalMoveRep ConditionalReps,
-	FVector_NetQuantize100 LFDiff,
+	FVector_NetQuantizeSparse100 LFDiff,
 	uint8 NewFlags,
 	FVRConditionalMoveRep2 MoveReps,
 	uint8 ClientMovementMode)
@@ -172,12 +172,12 @@ void AVRSimpleCharacter::ServerMoveVRDualHybridRootMotion_Implementation(
 	uint8 PendingFlags,
 	uint32 View0,
 	FVRConditionalMoveRep OldConditionalReps,
-	FVector_NetQuantize100 OldLFDiff,
+	FVector_NetQuantizeSparse100 OldLFDiff,
 	float TimeStamp,
 	FVector_NetQuantize10 InAccel,
 	FVector_NetQuantize100 ClientLoc,
 	FVRConditionalMoveRep ConditionalReps,
-	FVector_NetQuantize100 LFDiff,
+	FVector_NetQuantizeSparse100 LFDiff,
 	uint8 NewFlags,
 	FVRConditionalMoveRep2 MoveReps,
 	uint8 ClientMovementMode)
@@ -204,7 +204,7 @@ void AVRSimpleCharacter::ServerMoveVR_Implementation(
 	FVector_NetQuantize10 InAccel,
 	FVector_NetQuantize100 ClientLoc,
 	FVRConditionalMoveRep ConditionalReps,
-	FVector_NetQuantize100 LFDiff,
+	FVector_NetQuantizeSparse100 LFDiff,
 	uint8 MoveFlags,
 	FVRConditionalMoveRep2 MoveReps,
 	uint8 ClientMovementMode)
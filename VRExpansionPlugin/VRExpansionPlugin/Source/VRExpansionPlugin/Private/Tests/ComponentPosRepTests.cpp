@@ -0,0 +1,134 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "Engine/NetSerialization.h"
+#include "VRBPDatatypes.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace ComponentPosRepTests
+{
+	// Vector level (1 bit) + rotation level (2 bits)
+	static const int64 LevelHeaderBits = 3;
+
+	struct FRotationLevel
+	{
+		EVRRotationQuantization Level;
+		const TCHAR *           Name;
+		int64                   RotationBits;
+		float                   MaxErrorDegrees;
+	};
+
+	// 10 bits and shorts are off by at most half a step on each euler axis, smallest three is within 0.08 degrees
+	static const FRotationLevel RotationLevels[] =
+	{
+		{ EVRRotationQuantization::RoundTo10Bits       , TEXT("RoundTo10Bits")       , 30, 3.0f * 0.5f * (360.0f / 1024.0f)  },
+		{ EVRRotationQuantization::RoundToShort        , TEXT("RoundToShort")        , 48, 3.0f * 0.5f * (360.0f / 65536.0f) },
+		{ EVRRotationQuantization::RoundToSmallestThree, TEXT("RoundToSmallestThree"), 35, 0.08f                             }
+	};
+
+	// Angle between two rotations, from the imaginary part of the delta so it stays accurate for tiny angles
+	static float GetAngularErrorDegrees(const FRotator & A, const FRotator & B)
+	{
+		const FQuat Delta = A.Quaternion().Inverse() * B.Quaternion();
+		return FMath::RadiansToDegrees(2.0f * FMath::Atan2(FVector(Delta.X, Delta.Y, Delta.Z).Size(), FMath::Abs(Delta.W)));
+	}
+
+	static void GetTestRotations(TArray<FRotator> & OutRotations)
+	{
+		// Near and at gimbal lock
+		const float GimbalPitches[] = { 89.0f, 89.9f, 89.99f, 90.0f, -89.0f, -89.9f, -89.99f, -90.0f };
+
+		for (float Pitch : GimbalPitches)
+		{
+			OutRotations.Add(FRotator(Pitch, 0.0f, 0.0f));
+			OutRotations.Add(FRotator(Pitch, 135.0f, -60.0f));
+			OutRotations.Add(FRotator(Pitch, -170.0f, 175.0f));
+		}
+
+		OutRotations.Add(FRotator::ZeroRotator);
+		OutRotations.Add(FRotator(0.0f, 180.0f, 0.0f));
+		OutRotations.Add(FRotator(0.0f, 0.0f, -180.0f));
+
+		FRandomStream Stream(1138);
+
+		for (int32 i = 0; i < 256; ++i)
+		{
+			OutRotations.Add(FRotator(Stream.FRandRange(-90.0f, 90.0f), Stream.FRandRange(-180.0f, 180.0f), Stream.FRandRange(-180.0f, 180.0f)));
+		}
+	}
+
+	static int64 GetPackedPositionBits(const FVector & Position)
+	{
+		FNetBitWriter Writer(nullptr, 256);
+		FVector WritePosition = Position;
+		SerializePackedVector<100, 22>(WritePosition, Writer);
+		return Writer.GetNumBits();
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FComponentPosRepRoundTripTest, "VRExpansionPlugin.Replication.ComponentPosRepRoundTrip", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+/**
+* Writes and reads poses through FBPVRComponentPosRep::NetSerialize at every rotation quantization level and checks
+* the angular error bound of each level and the bits it costs.
+*/
+bool FComponentPosRepRoundTripTest::RunTest(const FString & Parameters)
+{
+	TArray<FRotator> Rotations;
+	ComponentPosRepTests::GetTestRotations(Rotations);
+
+	const FVector Position(35.27f, -120.5f, 165.03f);
+	const int64   PositionBits = ComponentPosRepTests::GetPackedPositionBits(Position);
+
+	for (const ComponentPosRepTests::FRotationLevel & RotationLevel : ComponentPosRepTests::RotationLevels)
+	{
+		float MaxError = 0.0f;
+
+		for (const FRotator & Rotation : Rotations)
+		{
+			FBPVRComponentPosRep WriteRep;
+			WriteRep.QuantizationLevel         = EVRVectorQuantization::RoundTwoDecimals;
+			WriteRep.RotationQuantizationLevel = RotationLevel.Level;
+			WriteRep.Position                  = Position;
+			WriteRep.Rotation                  = Rotation;
+
+			FNetBitWriter Writer(nullptr, 256);
+			bool bWriteSuccess = false;
+			WriteRep.NetSerialize(Writer, nullptr, bWriteSuccess);
+
+			// The reader starts from the other levels so they have to come off of the wire
+			FBPVRComponentPosRep ReadRep;
+			ReadRep.QuantizationLevel         = EVRVectorQuantization::RoundOneDecimal;
+			ReadRep.RotationQuantizationLevel = RotationLevel.Level == EVRRotationQuantization::RoundToShort ? EVRRotationQuantization::RoundTo10Bits : EVRRotationQuantization::RoundToShort;
+
+			FNetBitReader Reader(nullptr, Writer.GetData(), Writer.GetNumBits());
+			bool bReadSuccess = false;
+			ReadRep.NetSerialize(Reader, nullptr, bReadSuccess);
+
+			const FString Context = FString::Printf(TEXT("%s %s"), RotationLevel.Name, *Rotation.ToString());
+
+			TestTrue(Context + TEXT(" serialized"), bWriteSuccess && bReadSuccess && !Reader.IsError());
+			TestEqual(Context + TEXT(" bits"), Writer.GetNumBits(), ComponentPosRepTests::LevelHeaderBits + PositionBits + RotationLevel.RotationBits);
+			TestEqual(Context + TEXT(" read all bits"), Reader.GetPosBits(), Writer.GetNumBits());
+			TestTrue(Context + TEXT(" levels"), ReadRep.QuantizationLevel == WriteRep.QuantizationLevel && ReadRep.RotationQuantizationLevel == WriteRep.RotationQuantizationLevel);
+			TestTrue(Context + TEXT(" position"), ReadRep.Position.Equals(Position, 0.005f + KINDA_SMALL_NUMBER));
+
+			const float Error = ComponentPosRepTests::GetAngularErrorDegrees(Rotation, ReadRep.Rotation);
+			MaxError = FMath::Max(MaxError, Error);
+
+			if (Error > RotationLevel.MaxErrorDegrees)
+			{
+				AddError(FString::Printf(TEXT("%s angular error %.4f degrees is over %.4f"), *Context, Error, RotationLevel.MaxErrorDegrees));
+			}
+		}
+
+		AddInfo(FString::Printf(TEXT("%s: %lld rotation bits, max angular error %.4f degrees over %d rotations"), RotationLevel.Name, RotationLevel.RotationBits, MaxError, Rotations.Num()));
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,97 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/Package.h"
+#include "GripMotionControllerComponent.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GripArrayIndexTests
+{
+	static const int32 GripCounts[]  = { 1, 8, 64 };
+	static const int32 LookupsPerRun = 200000;
+
+	// Average ns per call of Lookup(i) over LookupsPerRun calls, Checksum keeps the results alive
+	template<typename LookupType>
+	static double TimeLookups(LookupType Lookup, int64 & Checksum)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+
+		for (int32 i = 0; i < LookupsPerRun; ++i)
+		{
+			Checksum += Lookup(i);
+		}
+
+		return ((FPlatformTime::Seconds() - StartTime) * 1.0e9) / LookupsPerRun;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGripArrayIndexLookupTest, "VRExpansionPlugin.Grips.GripArrayIndexLookup", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+/**
+* Checks that FGripArrayIndex returns the same slots as the IndexOfByKey searches it replaces, and logs the cost of
+* both for held (hit) and not held (miss) objects / IDs at 1, 8 and 64 grips.
+*/
+bool FGripArrayIndexLookupTest::RunTest(const FString & Parameters)
+{
+	int64 Checksum = 0;
+
+	for (int32 GripCount : GripArrayIndexTests::GripCounts)
+	{
+		TArray<FBPActorGripInformation> Grips;
+		TArray<UObject*>                HeldObjects;
+		UObject *                       NotHeldObject = NewObject<UObject>(GetTransientPackage(), NAME_None, RF_Transient);
+
+		for (int32 i = 0; i < GripCount; ++i)
+		{
+			FBPActorGripInformation Grip;
+			Grip.GripID        = (uint8)(i + 1);
+			Grip.GrippedObject = NewObject<UObject>(GetTransientPackage(), NAME_None, RF_Transient);
+
+			HeldObjects.Add(Grip.GrippedObject);
+			Grips.Add(Grip);
+		}
+
+		const uint8 NotHeldID = (uint8)(GripCount + 1);
+
+		FGripArrayIndex Index;
+
+		for (int32 i = 0; i < GripCount; ++i)
+		{
+			TestEqual(FString::Printf(TEXT("%d grips, FindByID slot %d"), GripCount, i), Index.FindByID(Grips, Grips[i].GripID), Grips.IndexOfByKey(Grips[i].GripID));
+			TestEqual(FString::Printf(TEXT("%d grips, FindByObject slot %d"), GripCount, i), Index.FindByObject(Grips, HeldObjects[i]), Grips.IndexOfByKey(HeldObjects[i]));
+		}
+
+		TestEqual(FString::Printf(TEXT("%d grips, FindByID miss"), GripCount), Index.FindByID(Grips, NotHeldID), (int32)INDEX_NONE);
+		TestEqual(FString::Printf(TEXT("%d grips, FindByObject miss"), GripCount), Index.FindByObject(Grips, NotHeldObject), (int32)INDEX_NONE);
+
+		// An in place change has to be marked dirty by whoever makes it
+		Grips[0].GrippedObject = NotHeldObject;
+		Index.MarkDirty();
+		TestEqual(FString::Printf(TEXT("%d grips, FindByObject after in place change"), GripCount), Index.FindByObject(Grips, NotHeldObject), 0);
+		Grips[0].GrippedObject = HeldObjects[0];
+		Index.MarkDirty();
+
+		const double IndexObjectHit  = GripArrayIndexTests::TimeLookups([&](int32 i) { return Index.FindByObject(Grips, HeldObjects[i % GripCount]); }, Checksum);
+		const double IndexObjectMiss = GripArrayIndexTests::TimeLookups([&](int32 i) { return Index.FindByObject(Grips, NotHeldObject); }, Checksum);
+		const double IndexIDHit      = GripArrayIndexTests::TimeLookups([&](int32 i) { return Index.FindByID(Grips, Grips[i % GripCount].GripID); }, Checksum);
+		const double IndexIDMiss     = GripArrayIndexTests::TimeLookups([&](int32 i) { return Index.FindByID(Grips, NotHeldID); }, Checksum);
+
+		const double LinearObjectHit  = GripArrayIndexTests::TimeLookups([&](int32 i) { return Grips.IndexOfByKey(HeldObjects[i % GripCount]); }, Checksum);
+		const double LinearObjectMiss = GripArrayIndexTests::TimeLookups([&](int32 i) { return Grips.IndexOfByKey(NotHeldObject); }, Checksum);
+		const double LinearIDHit      = GripArrayIndexTests::TimeLookups([&](int32 i) { return Grips.IndexOfByKey(Grips[i % GripCount].GripID); }, Checksum);
+		const double LinearIDMiss     = GripArrayIndexTests::TimeLookups([&](int32 i) { return Grips.IndexOfByKey(NotHeldID); }, Checksum);
+
+		AddInfo(FString::Printf(TEXT("%2d grips, ns per lookup (index / IndexOfByKey): object hit %.1f / %.1f, object miss %.1f / %.1f, ID hit %.1f / %.1f, ID miss %.1f / %.1f"),
+			GripCount,
+			IndexObjectHit, LinearObjectHit, IndexObjectMiss, LinearObjectMiss,
+			IndexIDHit    , LinearIDHit    , IndexIDMiss    , LinearIDMiss    ));
+	}
+
+	AddInfo(FString::Printf(TEXT("Checksum %lld"), Checksum));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
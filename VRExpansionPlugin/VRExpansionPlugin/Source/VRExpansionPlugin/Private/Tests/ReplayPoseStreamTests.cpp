@@ -0,0 +1,133 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Engine/NetSerialization.h"
+#include "Misc/VRReplayPoseStream.h"
+#include "VRBPDatatypes.h"
+#include "VRGlobalSettings.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace ReplayPoseStreamTests
+{
+	static const float SessionLength = 60.0f;
+
+	// Character relative poses of someone standing in place, bActiveHands swings both controllers around the whole time
+	static void GetSessionSample(float Time, bool bActiveHands, FVRReplayPoseSample & OutSample)
+	{
+		OutSample.Positions[FVRReplayPoseSample::Pose_Camera] = FVector(FMath::Sin(Time * 0.7f) * 3.0f, FMath::Cos(Time * 0.5f) * 2.0f, 170.0f + FMath::Sin(Time * 1.3f));
+		OutSample.Rotations[FVRReplayPoseSample::Pose_Camera] = FRotator(FMath::Sin(Time * 0.9f) * 10.0f, FMath::Sin(Time * 0.2f) * 60.0f, FMath::Sin(Time * 1.1f) * 2.0f);
+
+		for (int32 PoseIndex = FVRReplayPoseSample::Pose_LeftController; PoseIndex <= FVRReplayPoseSample::Pose_RightController; ++PoseIndex)
+		{
+			const float Side = PoseIndex == FVRReplayPoseSample::Pose_LeftController ? -1.0f : 1.0f;
+			const float Swing = bActiveHands ? Time * 2.0f * PI * (0.8f + 0.3f * Side) : 0.0f;
+			const float Reach = bActiveHands ? 25.0f : 0.0f;
+
+			OutSample.Positions[PoseIndex] = FVector(35.0f + FMath::Cos(Swing) * Reach, Side * 25.0f + FMath::Sin(Swing) * Reach, 110.0f + FMath::Sin(Swing * 0.5f) * Reach);
+			OutSample.Rotations[PoseIndex] = FRotator(FMath::Sin(Swing) * 45.0f * (Reach / 25.0f), Side * 15.0f + FMath::Cos(Swing) * 70.0f * (Reach / 25.0f), Side * 20.0f);
+		}
+	}
+
+	struct FSessionSize
+	{
+		int64 StreamBytes;    // Every completed batch through FVRReplayPoseBatch::NetSerialize
+		int64 ComponentBytes; // Each pose through FBPVRComponentPosRep::NetSerialize every sample, what was recorded before
+		int32 NumBatches;
+		float MaxPositionError;
+	};
+
+	static FSessionSize RecordSession(bool bActiveHands)
+	{
+		const UVRGlobalSettings * VRSettings = GetDefault<UVRGlobalSettings>();
+		const float SampleInterval = 1.0f / FMath::Clamp(VRSettings->ReplayPoseSampleRate, 1, 255);
+
+		FSessionSize Size = { 0, 0, 0, 0.0f };
+		FVRReplayPoseStream Stream;
+
+		// Offset by half an interval so float drift can't drop a sample off of the fixed rate
+		for (float Time = SampleInterval * 0.5f; Time < SessionLength; Time += SampleInterval)
+		{
+			FVRReplayPoseSample Sample;
+			GetSessionSample(Time, bActiveHands, Sample);
+
+			for (int32 PoseIndex = 0; PoseIndex < FVRReplayPoseSample::NumPoses; ++PoseIndex)
+			{
+				FBPVRComponentPosRep PoseRep;
+				PoseRep.Position = Sample.Positions[PoseIndex];
+				PoseRep.Rotation = Sample.Rotations[PoseIndex];
+
+				FNetBitWriter ComponentWriter(nullptr, 256);
+				bool bComponentSuccess = true;
+				PoseRep.NetSerialize(ComponentWriter, nullptr, bComponentSuccess);
+				Size.ComponentBytes += ComponentWriter.GetNumBytes();
+			}
+
+			FVRReplayPoseBatch Batch;
+
+			if (!Stream.Record(Time, Sample, Batch))
+				continue;
+
+			FNetBitWriter BatchWriter(nullptr, 0);
+			BatchWriter.SetAllowResize(true);
+			bool bWriteSuccess = true;
+			Batch.NetSerialize(BatchWriter, nullptr, bWriteSuccess);
+
+			Size.StreamBytes += BatchWriter.GetNumBytes();
+			++Size.NumBatches;
+
+			// Every sample has to come back within the 1/10th cm quantization
+			FVRReplayPoseBatch ReadBatch;
+			FNetBitReader BatchReader(nullptr, BatchWriter.GetData(), BatchWriter.GetNumBits());
+			bool bReadSuccess = true;
+			ReadBatch.NetSerialize(BatchReader, nullptr, bReadSuccess);
+
+			if (bWriteSuccess && bReadSuccess && ReadBatch.Samples.Num() == Batch.Samples.Num())
+			{
+				for (int32 SampleIndex = 0; SampleIndex < Batch.Samples.Num(); ++SampleIndex)
+				{
+					for (int32 PoseIndex = 0; PoseIndex < FVRReplayPoseSample::NumPoses; ++PoseIndex)
+					{
+						const float Error = (ReadBatch.Samples[SampleIndex].Positions[PoseIndex] - Batch.Samples[SampleIndex].Positions[PoseIndex]).GetAbsMax();
+						Size.MaxPositionError = FMath::Max(Size.MaxPositionError, Error);
+					}
+				}
+			}
+			else
+			{
+				Size.MaxPositionError = BIG_NUMBER;
+			}
+		}
+
+		return Size;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FReplayPoseStreamSizeTest, "VRExpansionPlugin.Replays.ReplayPoseStreamSize", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+/**
+* Records a minute of scripted tracked poses through FVRReplayPoseStream and through the per component pose reps it replaces,
+* and reports the pose payload bytes per minute of both for idle and active hands. Bunch and property headers are not included
+* on either side, a real replays file size per minute still has to be taken from a recording.
+*/
+bool FReplayPoseStreamSizeTest::RunTest(const FString & Parameters)
+{
+	const bool bActiveHandsModes[] = { false, true };
+
+	for (bool bActiveHands : bActiveHandsModes)
+	{
+		const ReplayPoseStreamTests::FSessionSize Size = ReplayPoseStreamTests::RecordSession(bActiveHands);
+		const TCHAR * ModeName = bActiveHands ? TEXT("active hands") : TEXT("idle hands");
+
+		TestTrue(FString::Printf(TEXT("%s batches recorded"), ModeName), Size.NumBatches > 0);
+		TestTrue(FString::Printf(TEXT("%s batches round trip within 0.05cm"), ModeName), Size.MaxPositionError <= 0.05f + KINDA_SMALL_NUMBER);
+
+		AddInfo(FString::Printf(TEXT("%s: pose stream %lld bytes/min in %d batches, component pose reps %lld bytes/min (%.0f%%)"),
+			ModeName, Size.StreamBytes, Size.NumBatches, Size.ComponentBytes, Size.ComponentBytes > 0 ? (100.0 * Size.StreamBytes) / Size.ComponentBytes : 0.0));
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
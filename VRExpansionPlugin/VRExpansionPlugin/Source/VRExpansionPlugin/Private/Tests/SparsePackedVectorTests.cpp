@@ -0,0 +1,140 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Engine/NetSerialization.h"
+#include "VRBaseCharacterMovementComponent.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace SparsePackedVectorTests
+{
+	struct FMoveVector
+	{
+		const TCHAR * Name;
+		FVector       Value;
+		bool          bExpectSmaller; // Sparse packing is expected to win on this value, small or three axis values can come out even or larger
+	};
+
+	// Representative client move values, LFDiff and CapsuleLoc were FVector_NetQuantize100 (<100, 30>) and the conditional reps <100, 22>
+	static const FMoveVector LFDiffValues[] =
+	{
+		{ TEXT("LFDiff zero")          , FVector(0.0f, 0.0f, 0.0f)         , true  },
+		{ TEXT("LFDiff planar")        , FVector(1.23f, -0.57f, 0.0f)      , false },
+		{ TEXT("LFDiff planar large")  , FVector(-4.82f, 3.06f, 0.0f)      , true  },
+		{ TEXT("LFDiff with height")   , FVector(0.41f, 0.12f, -0.35f)     , false }
+	};
+
+	static const FMoveVector CapsuleLocValues[] =
+	{
+		{ TEXT("CapsuleLoc centered")  , FVector(0.0f, 0.0f, 0.0f)         , true  },
+		{ TEXT("CapsuleLoc leaning")   , FVector(-23.41f, 15.02f, 0.0f)    , true  },
+		{ TEXT("CapsuleLoc room scale"), FVector(112.57f, -87.3f, 0.0f)    , true  }
+	};
+
+	static const FMoveVector ConditionalValues[] =
+	{
+		{ TEXT("CustomVRInputVector")  , FVector(35.5f, -12.25f, 0.0f)     , true  },
+		{ TEXT("RequestedVelocity")    , FVector(150.37f, 88.12f, 0.0f)    , true  },
+		{ TEXT("RequestedVelocity 3D") , FVector(-210.4f, 33.9f, 120.25f)  , false }
+	};
+
+	template<int32 MaxBits>
+	static int64 RoundTripPacked(const FVector & Value, FVector & OutValue)
+	{
+		FNetBitWriter Writer(nullptr, 256);
+		FVector WriteValue = Value;
+		SerializePackedVector<100, MaxBits>(WriteValue, Writer);
+
+		FNetBitReader Reader(nullptr, Writer.GetData(), Writer.GetNumBits());
+		SerializePackedVector<100, MaxBits>(OutValue, Reader);
+		return Writer.GetNumBits();
+	}
+
+	template<int32 MaxBits>
+	static int64 RoundTripSparse(const FVector & Value, FVector & OutValue)
+	{
+		FNetBitWriter Writer(nullptr, 256);
+		FVector WriteValue = Value;
+		SerializeSparsePackedVector<100, MaxBits>(WriteValue, Writer);
+
+		FNetBitReader Reader(nullptr, Writer.GetData(), Writer.GetNumBits());
+		SerializeSparsePackedVector<100, MaxBits>(OutValue, Reader);
+		return Writer.GetNumBits();
+	}
+
+	// 3 presence bits, then if any axis is present a 5 bit width and that width per present axis
+	static int64 GetExpectedSparseBits(const FVector & Value)
+	{
+		int32  NumPresent = 0;
+		uint32 NumBits    = 0;
+
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			const int32 Quantized = FMath::RoundToInt(Value[Axis] * 100);
+
+			if (Quantized != 0)
+			{
+				const uint32 ZigZag = (uint32)((Quantized << 1) ^ (Quantized >> 31));
+				NumBits = FMath::Max(NumBits, FMath::FloorLog2(ZigZag) + 1);
+				++NumPresent;
+			}
+		}
+
+		return 3 + (NumPresent > 0 ? 5 + NumPresent * NumBits : 0);
+	}
+
+	template<int32 MaxBits>
+	static void RunValues(FAutomationTestBase & Test, const FMoveVector * Values, int32 NumValues, int64 & TotalPackedBits, int64 & TotalSparseBits)
+	{
+		for (int32 i = 0; i < NumValues; ++i)
+		{
+			const FMoveVector & MoveVector = Values[i];
+
+			FVector PackedValue = FVector::ZeroVector;
+			FVector SparseValue = FVector::ZeroVector;
+
+			const int64 PackedBits = RoundTripPacked<MaxBits>(MoveVector.Value, PackedValue);
+			const int64 SparseBits = RoundTripSparse<MaxBits>(MoveVector.Value, SparseValue);
+
+			Test.TestTrue(FString::Printf(TEXT("%s decodes to the same quantized value (%s / %s)"), MoveVector.Name, *PackedValue.ToString(), *SparseValue.ToString()),
+				PackedValue.X == SparseValue.X && PackedValue.Y == SparseValue.Y && PackedValue.Z == SparseValue.Z);
+
+			Test.TestEqual(FString::Printf(TEXT("%s sparse bits"), MoveVector.Name), SparseBits, GetExpectedSparseBits(MoveVector.Value));
+
+			if (MoveVector.bExpectSmaller)
+			{
+				Test.TestTrue(FString::Printf(TEXT("%s sparse (%lld bits) is smaller than packed (%lld bits)"), MoveVector.Name, SparseBits, PackedBits), SparseBits < PackedBits);
+			}
+
+			Test.AddInfo(FString::Printf(TEXT("%-22s packed <100, %d> %3lld bits, sparse %3lld bits"), MoveVector.Name, MaxBits, PackedBits, SparseBits));
+
+			TotalPackedBits += PackedBits;
+			TotalSparseBits += SparseBits;
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSparsePackedVectorTest, "VRExpansionPlugin.Replication.SparsePackedVector", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+/**
+* Serializes representative LFDiff, CapsuleLoc and conditional move rep values through both the packed vector the old
+* ServerMoveVR signatures used and SerializeSparsePackedVector, checks that both decode to the same quantized values and
+* compares their sizes.
+*/
+bool FSparsePackedVectorTest::RunTest(const FString & Parameters)
+{
+	int64 TotalPackedBits = 0;
+	int64 TotalSparseBits = 0;
+
+	SparsePackedVectorTests::RunValues<30>(*this, SparsePackedVectorTests::LFDiffValues, ARRAY_COUNT(SparsePackedVectorTests::LFDiffValues), TotalPackedBits, TotalSparseBits);
+	SparsePackedVectorTests::RunValues<30>(*this, SparsePackedVectorTests::CapsuleLocValues, ARRAY_COUNT(SparsePackedVectorTests::CapsuleLocValues), TotalPackedBits, TotalSparseBits);
+	SparsePackedVectorTests::RunValues<22>(*this, SparsePackedVectorTests::ConditionalValues, ARRAY_COUNT(SparsePackedVectorTests::ConditionalValues), TotalPackedBits, TotalSparseBits);
+
+	TestTrue(TEXT("Sparse packing is smaller over the representative set"), TotalSparseBits < TotalPackedBits);
+	AddInfo(FString::Printf(TEXT("Total: packed %lld bits (%lld bytes), sparse %lld bits (%lld bytes)"), TotalPackedBits, (TotalPackedBits + 7) / 8, TotalSparseBits, (TotalSparseBits + 7) / 8));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,149 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "Engine/NetSerialization.h"
+#include "FTransform_NetQuantize.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace TransformNetQuantizeTests
+{
+	// Half of the 1/100 translation step
+	static const float MaxTranslationError = 0.005f;
+
+	// Half a step of 12 bit smallest three on each of the three sent elements, about 0.034 degrees
+	static const float MaxRotationErrorDegrees = 0.04f;
+
+	// Range the request asked to hold two decimals in, inside of the relative profiles packed range
+	static const float TestedTranslationRange = 5243.0f;
+
+	// Largest + / - value each profile can pack, SerializePackedVector<Scale, MaxBits> holds [-2^MaxBits, 2^MaxBits - 1] / Scale
+	static const double RelativeMaxTranslation = double(1 << 20) / 100.0;
+	static const double WorldMaxTranslation    = double(1 << 30) / 100.0;
+
+	static float GetAngularErrorDegrees(const FQuat & A, const FQuat & B)
+	{
+		const FQuat Delta = A.Inverse() * B;
+		return FMath::RadiansToDegrees(2.0f * FMath::Atan2(FVector(Delta.X, Delta.Y, Delta.Z).Size(), FMath::Abs(Delta.W)));
+	}
+
+	template<uint32 MaxBits>
+	static int64 GetPackedVectorBits(const FVector & Vector)
+	{
+		FNetBitWriter Writer(nullptr, 256);
+		FVector WriteVector = Vector;
+		SerializePackedVector<100, MaxBits>(WriteVector, Writer);
+		return Writer.GetNumBits();
+	}
+
+	template<typename ProfileType>
+	static bool RoundTrip(const FTransform & InTransform, FTransform & OutTransform, int64 & OutBits)
+	{
+		ProfileType WriteTransform(InTransform);
+		FNetBitWriter Writer(nullptr, 1024);
+		bool bWriteSuccess = false;
+		WriteTransform.NetSerialize(Writer, nullptr, bWriteSuccess);
+
+		ProfileType ReadTransform;
+		FNetBitReader Reader(nullptr, Writer.GetData(), Writer.GetNumBits());
+		bool bReadSuccess = false;
+		ReadTransform.NetSerialize(Reader, nullptr, bReadSuccess);
+
+		OutTransform = ReadTransform;
+		OutBits      = Writer.GetNumBits();
+		return bWriteSuccess && bReadSuccess && !Reader.IsError() && Reader.GetPosBits() == Writer.GetNumBits();
+	}
+
+	template<typename ProfileType, uint32 MaxBits>
+	static void RunProfile(FAutomationTestBase & Test, const TCHAR * ProfileName, double MaxTranslation)
+	{
+		FRandomStream Stream(2112);
+		float MaxTranslationSeen = 0.0f;
+		float MaxRotationSeen    = 0.0f;
+
+		// Translation and rotation error, and what every part costs, inside of the tested range
+		for (int32 i = 0; i < 512; ++i)
+		{
+			const FVector Translation = (i == 0) ? FVector(TestedTranslationRange, -TestedTranslationRange, TestedTranslationRange) :
+				FVector(Stream.FRandRange(-TestedTranslationRange, TestedTranslationRange), Stream.FRandRange(-TestedTranslationRange, TestedTranslationRange), Stream.FRandRange(-TestedTranslationRange, TestedTranslationRange));
+
+			const FQuat Rotation = FRotator(Stream.FRandRange(-90.0f, 90.0f), Stream.FRandRange(-180.0f, 180.0f), Stream.FRandRange(-180.0f, 180.0f)).Quaternion();
+
+			FTransform Result;
+			int64 Bits = 0;
+			const bool bSuccess = RoundTrip<ProfileType>(FTransform(Rotation, Translation), Result, Bits);
+
+			const FString Context = FString::Printf(TEXT("%s %s"), ProfileName, *Translation.ToString());
+			Test.TestTrue(Context + TEXT(" serialized"), bSuccess);
+
+			const float TranslationError = (Result.GetTranslation() - Translation).GetAbsMax();
+			const float RotationError    = GetAngularErrorDegrees(Rotation, Result.GetRotation());
+
+			MaxTranslationSeen = FMath::Max(MaxTranslationSeen, TranslationError);
+			MaxRotationSeen    = FMath::Max(MaxRotationSeen, RotationError);
+
+			if (TranslationError > MaxTranslationError + KINDA_SMALL_NUMBER)
+				Test.AddError(FString::Printf(TEXT("%s translation error %.5f is over %.5f"), *Context, TranslationError, MaxTranslationError));
+
+			if (RotationError > MaxRotationErrorDegrees)
+				Test.AddError(FString::Printf(TEXT("%s rotation error %.4f degrees is over %.4f"), *Context, RotationError, MaxRotationErrorDegrees));
+
+			// Translation, then 2 bit largest index + 3 x 12 bits, then the unit scale bit and nothing else
+			Test.TestEqual(Context + TEXT(" bits"), Bits, GetPackedVectorBits<MaxBits>(Translation) + 2 + 3 * 12 + 1);
+			Test.TestTrue(Context + TEXT(" unit scale"), Result.GetScale3D().Equals(FVector::OneVector, 0.0f));
+		}
+
+		// Non unit scale pays the flag bit and the default packed vector
+		{
+			const FVector Scale(1.5f, 0.25f, 2.0f);
+			FTransform Result;
+			int64 Bits = 0;
+			RoundTrip<ProfileType>(FTransform(FQuat::Identity, FVector::ZeroVector, Scale), Result, Bits);
+
+			Test.TestEqual(FString::Printf(TEXT("%s scaled bits"), ProfileName), Bits, GetPackedVectorBits<MaxBits>(FVector::ZeroVector) + 2 + 3 * 12 + 1 + GetPackedVectorBits<30>(Scale));
+			Test.TestTrue(FString::Printf(TEXT("%s scale"), ProfileName), Result.GetScale3D().Equals(Scale, MaxTranslationError + KINDA_SMALL_NUMBER));
+		}
+
+		// Outside of the packed range each axis clamps to the edge of it and the write reports failure
+		{
+			const FVector Translation((float)(MaxTranslation * 1.5), (float)(-MaxTranslation * 1.5), 100.0f);
+			FTransform Result;
+			int64 Bits = 0;
+			const bool bSuccess = RoundTrip<ProfileType>(FTransform(FQuat::Identity, Translation), Result, Bits);
+
+			// World range values are past float integer precision once scaled, so allow a cm there
+			const float Tolerance = MaxTranslation > 1.0e5 ? 1.0f : MaxTranslationError + KINDA_SMALL_NUMBER;
+
+			Test.TestFalse(FString::Printf(TEXT("%s out of range reports clamping"), ProfileName), bSuccess);
+			Test.TestEqual(FString::Printf(TEXT("%s clamped +X"), ProfileName), Result.GetTranslation().X, (float)(MaxTranslation - 0.01), Tolerance);
+			Test.TestEqual(FString::Printf(TEXT("%s clamped -Y"), ProfileName), Result.GetTranslation().Y, (float)(-MaxTranslation), Tolerance);
+			Test.TestEqual(FString::Printf(TEXT("%s in range Z"), ProfileName), Result.GetTranslation().Z, 100.0f, Tolerance);
+		}
+
+		Test.AddInfo(FString::Printf(TEXT("%s: max translation error %.5f cm, max rotation error %.4f degrees"), ProfileName, MaxTranslationSeen, MaxRotationSeen));
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTransformNetQuantizeProfilesTest, "VRExpansionPlugin.Replication.TransformNetQuantizeProfiles", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+/**
+* Round trips FTransform_NetQuantizeRelative and FTransform_NetQuantizeWorld and checks the translation and rotation error
+* bounds, clamping outside of the packed range and that unit scale costs a single bit.
+*/
+bool FTransformNetQuantizeProfilesTest::RunTest(const FString & Parameters)
+{
+	if (FTransform_NetQuantize::IsHighPrecisionEnabled())
+	{
+		AddWarning(TEXT("vrexp.RepHighPrecisionTransforms is on, the bounded profiles are bypassed"));
+		return true;
+	}
+
+	TransformNetQuantizeTests::RunProfile<FTransform_NetQuantizeRelative, 20>(*this, TEXT("Relative"), TransformNetQuantizeTests::RelativeMaxTranslation);
+	TransformNetQuantizeTests::RunProfile<FTransform_NetQuantizeWorld, 30>(*this, TEXT("World"), TransformNetQuantizeTests::WorldMaxTranslation);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,138 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Components/BoxComponent.h"
+#include "VRRootComponent.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace VRRootOverlapTests
+{
+	// A 15 x 15 grid of small overlap volumes 30cm apart around the capsule, a crowded room of pickups / triggers
+	static const int32 GridSize    = 15;
+	static const float GridSpacing = 30.0f;
+	static const float BoxExtent   = 10.0f;
+	static const int32 NumMoves    = 2000;
+
+	struct FOverlapMode
+	{
+		const TCHAR * Name;
+		bool          bUseIncrementalOverlaps;
+		int32         MaxTests;
+	};
+
+	static const FOverlapMode OverlapModes[] =
+	{
+		{ TEXT("full query")                  , false, 0 },
+		{ TEXT("incremental, no test limit")  , true , 0 },
+		{ TEXT("incremental, default limit")  , true , -1 } // -1 keeps the component default
+	};
+
+	static AActor * SpawnOverlapBox(UWorld * World, const FVector & Location)
+	{
+		AActor * BoxActor = World->SpawnActor<AActor>(Location, FRotator::ZeroRotator);
+		UBoxComponent * Box = NewObject<UBoxComponent>(BoxActor);
+		Box->SetBoxExtent(FVector(BoxExtent));
+		Box->SetCollisionProfileName(TEXT("OverlapAllDynamic"));
+		Box->SetGenerateOverlapEvents(true);
+		BoxActor->SetRootComponent(Box);
+		Box->RegisterComponent();
+		Box->SetWorldLocation(Location);
+		return BoxActor;
+	}
+
+	// Head sway and small room scale steps, mostly staying inside of the candidate region with the odd step out of it
+	static FVector GetMoveLocation(int32 Move)
+	{
+		const float Time = Move * 0.05f;
+		return FVector(FMath::Sin(Time) * 40.0f, FMath::Cos(Time * 0.7f) * 40.0f, 0.0f);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRRootOverlapCrowdedTest, "VRExpansionPlugin.Movement.VRRootOverlapCrowded", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+/**
+* Moves a UVRRootComponent through a grid of overlap volumes with the full overlap query, the incremental overlaps with
+* no test limit and the incremental overlaps with the default IncrementalOverlapMaxTests. Checks that every mode ends up
+* with the same overlaps after every move and logs the time per move, the STAT_VRRootUpdateOverlaps scope plus a transform
+* update that is the same in every mode.
+*/
+bool FVRRootOverlapCrowdedTest::RunTest(const FString & Parameters)
+{
+	UWorld * World = UWorld::CreateWorld(EWorldType::Game, false);
+	FWorldContext & WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	FURL URL;
+	World->InitializeActorsForPlay(URL);
+	World->BeginPlay();
+
+	for (int32 X = 0; X < VRRootOverlapTests::GridSize; ++X)
+	{
+		for (int32 Y = 0; Y < VRRootOverlapTests::GridSize; ++Y)
+		{
+			const float HalfGrid = (VRRootOverlapTests::GridSize - 1) * 0.5f;
+			VRRootOverlapTests::SpawnOverlapBox(World, FVector((X - HalfGrid) * VRRootOverlapTests::GridSpacing, (Y - HalfGrid) * VRRootOverlapTests::GridSpacing, 0.0f));
+		}
+	}
+
+	AActor * RootActor = World->SpawnActor<AActor>(FVector::ZeroVector, FRotator::ZeroRotator);
+	UVRRootComponent * Root = NewObject<UVRRootComponent>(RootActor);
+	Root->SetCapsuleSize(20.0f, 90.0f);
+	Root->SetCollisionProfileName(TEXT("Pawn"));
+	Root->SetGenerateOverlapEvents(true);
+	RootActor->SetRootComponent(Root);
+	Root->RegisterComponent();
+
+	const int32 DefaultMaxTests = Root->IncrementalOverlapMaxTests;
+
+	TArray<int32> ReferenceOverlapCounts;
+
+	for (const VRRootOverlapTests::FOverlapMode & Mode : VRRootOverlapTests::OverlapModes)
+	{
+		Root->BUseIncrementalOverlaps    = Mode.bUseIncrementalOverlaps;
+		Root->IncrementalOverlapMaxTests = Mode.MaxTests < 0 ? DefaultMaxTests : Mode.MaxTests;
+
+		// Start every mode from the same place with fresh candidates
+		Root->SetWorldLocation(FVector(0.0f, 0.0f, 1000.0f));
+		Root->SetWorldLocation(VRRootOverlapTests::GetMoveLocation(0));
+
+		TArray<int32> OverlapCounts;
+		TArray<UPrimitiveComponent*> Overlapping;
+		double UpdateSeconds = 0.0;
+
+		for (int32 Move = 1; Move <= VRRootOverlapTests::NumMoves; ++Move)
+		{
+			// Not swept, so the only query the move runs is the one in UpdateOverlaps
+			const double StartTime = FPlatformTime::Seconds();
+			Root->SetWorldLocation(VRRootOverlapTests::GetMoveLocation(Move), false, nullptr, ETeleportType::TeleportPhysics);
+			UpdateSeconds += FPlatformTime::Seconds() - StartTime;
+
+			Root->GetOverlappingComponents(Overlapping);
+			OverlapCounts.Add(Overlapping.Num());
+		}
+
+		if (ReferenceOverlapCounts.Num() == 0)
+		{
+			ReferenceOverlapCounts = OverlapCounts;
+		}
+		else
+		{
+			TestTrue(FString::Printf(TEXT("%s finds the same overlaps as the full query"), Mode.Name), OverlapCounts == ReferenceOverlapCounts);
+		}
+
+		AddInfo(FString::Printf(TEXT("%-28s %.2f us per move over %d moves (max tests %d)"), Mode.Name, (UpdateSeconds * 1.0e6) / VRRootOverlapTests::NumMoves, VRRootOverlapTests::NumMoves, Root->IncrementalOverlapMaxTests));
+	}
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
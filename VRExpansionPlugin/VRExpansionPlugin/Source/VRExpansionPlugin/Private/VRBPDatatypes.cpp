@@ -44,7 +44,7 @@ bool FBPVRComponentPosRep::NetSerialize(FArchive& Ar, class UPackageMap* Map, bo
 	uint8 Flags = (uint8)QuantizationLevel;
 	*/
 	Ar.SerializeBits(&QuantizationLevel        , 1); // Only two values 0:1
-	Ar.SerializeBits(&RotationQuantizationLevel, 1); // Only two values 0:1
+	Ar.SerializeBits(&RotationQuantizationLevel, 2); // Three values 0:2
 
 	/*
 	No longer using their built in rotation rep, as controllers will rarely if ever be at 0 rot on an axis and 
@@ -103,6 +103,10 @@ bool FBPVRComponentPosRep::NetSerialize(FArchive& Ar, class UPackageMap* Map, bo
 			Ar << ShortYaw  ;
 			Ar << ShortRoll ;
 		}break;
+		case EVRRotationQuantization::RoundToSmallestThree:
+		{
+			SerializeSmallestThree(Ar);
+		}break;
 		}
 	}
 	else   // If loading
@@ -150,10 +154,72 @@ bool FBPVRComponentPosRep::NetSerialize(FArchive& Ar, class UPackageMap* Map, bo
 
 			break;
 		}
+		case EVRRotationQuantization::RoundToSmallestThree:
+		{
+			SerializeSmallestThree(Ar);
+
+			break;
+		}
 		}
 	}
 
 	return bOutSuccess;
 }
 
+/**
+Smallest three quaternion packing, 11 bits per element, see FTransform_NetQuantize::SerializeQuat_SmallestThree.
+*/
+void FBPVRComponentPosRep::SerializeSmallestThree(FArchive& Ar)
+{
+	FQuat Quat = Ar.IsSaving() ? Rotation.Quaternion() : FQuat::Identity;
+
+	FTransform_NetQuantize::SerializeQuat_SmallestThree<11>(Ar, Quat);
+
+	if (Ar.IsLoading())
+		Rotation = Quat.Rotator();
+}
+
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\
+
+// FBPVRTrackedPoseFrame \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\
+
+// Public
+
+// Functions
+
+/**
+Network serialization
+
+One header for all three poses, the quantization bits of each pose are still written by its own NetSerialize.
+*/
+bool FBPVRTrackedPoseFrame::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+{
+	bOutSuccess = true;
+
+	Ar.SerializeBits(&ValidPoses, 3);
+	Ar << TimeStamp;
+
+	bool bPoseSuccess = true;
+
+	if (HasPose(Pose_Camera))
+	{
+		Camera.NetSerialize(Ar, Map, bPoseSuccess);
+		bOutSuccess &= bPoseSuccess;
+	}
+
+	if (HasPose(Pose_LeftController))
+	{
+		LeftController.NetSerialize(Ar, Map, bPoseSuccess);
+		bOutSuccess &= bPoseSuccess;
+	}
+
+	if (HasPose(Pose_RightController))
+	{
+		RightController.NetSerialize(Ar, Map, bPoseSuccess);
+		bOutSuccess &= bPoseSuccess;
+	}
+
+	return bOutSuccess;
+}
+
 //\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\
@@ -3,10 +3,17 @@
 #include "VRBaseCharacter.h"
 #include "NavigationSystem.h"
 #include "VRPathFollowingComponent.h"
+#include "TimerManager.h"
+#include "Engine/DemoNetDriver.h"
+#include "Grippables/GrippableActor.h"
+#include "Grippables/GrippableStaticMeshActor.h"
+#include "Grippables/GrippableSkeletalMeshActor.h"
 //#include "Runtime/Engine/Private/EnginePrivate.h"
 
 DEFINE_LOG_CATEGORY(LogBaseVRCharacter);
 
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Client Auth Movement Rejected"), STAT_ClientAuthMovementRejected, STATGROUP_TickGrip);
+
 FName AVRBaseCharacter::LeftMotionControllerComponentName(TEXT("Left Grip Motion Controller"));
 FName AVRBaseCharacter::RightMotionControllerComponentName(TEXT("Right Grip Motion Controller"));
 FName AVRBaseCharacter::ReplicatedCameraComponentName(TEXT("VR Replicated Camera"));
@@ -98,6 +105,247 @@ AVRBaseCharacter::AVRBaseCharacter(const FObjectInitializer& ObjectInitializer)
 	VRReplicateCapsuleHeight = false;
 
 	bUseExperimentalUnseatModeFix = true;
+
+	bAggregateTrackedPoses = false;
+	LastTrackedPoseFrameTimeStamp = 0.0f;
+
+	TrackedPoseFrameTickFunction.bCanEverTick = true;
+	TrackedPoseFrameTickFunction.bStartWithTickEnabled = true;
+	TrackedPoseFrameTickFunction.bAllowTickOnDedicatedServer = false;
+	TrackedPoseFrameTickFunction.TickGroup = TG_PrePhysics;
+
+	bBatchClientAuthThrows = true;
+	bClientAuthThrowFlushPending = false;
+	LastClientAuthThrowBatchTimeStamp = 0.0f;
+}
+
+void AVRBaseCharacter::RegisterActorTickFunctions(bool bRegister)
+{
+	Super::RegisterActorTickFunctions(bRegister);
+
+	UpdateTrackedPoseFrameTickRegistration(bRegister);
+}
+
+void AVRBaseCharacter::OnRep_Controller()
+{
+	Super::OnRep_Controller();
+
+	// Possession reaches the client after the tick functions were registered
+	UpdateTrackedPoseFrameTickRegistration(PrimaryActorTick.IsTickFunctionRegistered());
+}
+
+void AVRBaseCharacter::UpdateTrackedPoseFrameTickRegistration(bool bActorTicksRegistered)
+{
+	// Only the owning client ever sends the frame, simulated proxies never tick it
+	const bool bShouldRegister = bActorTicksRegistered && bAggregateTrackedPoses && !IsTemplate() && GetNetMode() == NM_Client && IsLocallyControlled();
+
+	if (bShouldRegister == TrackedPoseFrameTickFunction.IsTickFunctionRegistered())
+		return;
+
+	if (bShouldRegister)
+	{
+		TrackedPoseFrameTickFunction.Target = this;
+		TrackedPoseFrameTickFunction.RegisterTickFunction(GetLevel());
+
+		if (VRReplicatedCamera)
+			TrackedPoseFrameTickFunction.AddPrerequisite(VRReplicatedCamera, VRReplicatedCamera->PrimaryComponentTick);
+
+		if (LeftMotionController)
+			TrackedPoseFrameTickFunction.AddPrerequisite(LeftMotionController, LeftMotionController->PrimaryComponentTick);
+
+		if (RightMotionController)
+			TrackedPoseFrameTickFunction.AddPrerequisite(RightMotionController, RightMotionController->PrimaryComponentTick);
+	}
+	else
+	{
+		TrackedPoseFrameTickFunction.UnRegisterTickFunction();
+		PendingTrackedPoseFrame.Reset();
+	}
+}
+
+bool AVRBaseCharacter::StageTrackedPose(FBPVRTrackedPoseFrame::EPoseBits Pose, const FBPVRComponentPosRep & NewTransform)
+{
+	if (!bAggregateTrackedPoses || !TrackedPoseFrameTickFunction.IsTickFunctionRegistered())
+		return false;
+
+	switch (Pose)
+	{
+	case FBPVRTrackedPoseFrame::Pose_Camera: PendingTrackedPoseFrame.Camera = NewTransform; break;
+	case FBPVRTrackedPoseFrame::Pose_LeftController: PendingTrackedPoseFrame.LeftController = NewTransform; break;
+	case FBPVRTrackedPoseFrame::Pose_RightController: PendingTrackedPoseFrame.RightController = NewTransform; break;
+	default: return false;
+	}
+
+	PendingTrackedPoseFrame.ValidPoses |= Pose;
+	return true;
+}
+
+void AVRBaseCharacter::FlushTrackedPoseFrame()
+{
+	if (!PendingTrackedPoseFrame.HasAnyPose())
+		return;
+
+	if (UWorld * World = GetWorld())
+	{
+		PendingTrackedPoseFrame.TimeStamp = World->GetTimeSeconds();
+		Server_SendTrackedPoseFrame(PendingTrackedPoseFrame);
+	}
+
+	PendingTrackedPoseFrame.Reset();
+}
+
+bool AVRBaseCharacter::QueueClientAuthThrow(AActor * ThrownActor, const FRepMovementVR & NewMovement)
+{
+	if (!ThrownActor)
+		return false;
+
+	AVRBaseCharacter * OwningChar = FindOwningVRCharacter(ThrownActor);
+
+	if (!OwningChar || !OwningChar->bBatchClientAuthThrows || OwningChar->IsPendingKill())
+		return false;
+
+	UWorld * World = OwningChar->GetWorld();
+
+	if (!World)
+		return false;
+
+	FVRClientAuthThrowEntry * Entry = OwningChar->PendingClientAuthThrows.Entries.FindByPredicate([ThrownActor](const FVRClientAuthThrowEntry & Other)
+	{
+		return Other.ThrownActor == ThrownActor;
+	});
+
+	if (!Entry)
+	{
+		Entry = &OwningChar->PendingClientAuthThrows.Entries.AddDefaulted_GetRef();
+		Entry->ThrownActor = ThrownActor;
+	}
+
+	Entry->Movement = NewMovement;
+
+	if (!OwningChar->bClientAuthThrowFlushPending)
+	{
+		OwningChar->bClientAuthThrowFlushPending = true;
+		World->GetTimerManager().SetTimerForNextTick(OwningChar, &AVRBaseCharacter::FlushClientAuthThrows);
+	}
+
+	return true;
+}
+
+AVRBaseCharacter * AVRBaseCharacter::FindOwningVRCharacter(const AActor * OwnedActor)
+{
+	if (!OwnedActor)
+		return nullptr;
+
+	// Grippables are owned by the character, or by the controller that possesses it
+	for (AActor * Owner = OwnedActor->GetOwner(); Owner != nullptr; Owner = Owner->GetOwner())
+	{
+		if (AVRBaseCharacter * OwningChar = Cast<AVRBaseCharacter>(Owner))
+			return OwningChar;
+
+		if (AController * OwningController = Cast<AController>(Owner))
+		{
+			if (AVRBaseCharacter * OwningChar = Cast<AVRBaseCharacter>(OwningController->GetPawn()))
+				return OwningChar;
+		}
+	}
+
+	return nullptr;
+}
+
+bool AVRBaseCharacter::ValidateClientAuthMovement(AActor * ThrownActor, FVRClientAuthReplicationData & ReplicationData, const FRepMovementVR & NewMovement)
+{
+	const UVRGlobalSettings * VRSettings = GetDefault<UVRGlobalSettings>();
+	UWorld * World = ThrownActor ? ThrownActor->GetWorld() : nullptr;
+
+	if (!VRSettings->bValidateClientAuthMovement || !World)
+		return true;
+
+	const float MaxSpeed = VRSettings->ClientAuthMaxThrowSpeed;
+
+	if (NewMovement.LinearVelocity.SizeSquared() > FMath::Square(MaxSpeed))
+	{
+		INC_DWORD_STAT(STAT_ClientAuthMovementRejected);
+		return false;
+	}
+
+	const float ServerTime = World->GetTimeSeconds();
+	AVRBaseCharacter * OwningChar = FindOwningVRCharacter(ThrownActor);
+
+	// Round trip, the client was acting on a world state at least this old
+	float Latency = 0.0f;
+	if (OwningChar && OwningChar->GetPlayerState())
+	{
+		Latency = FMath::Clamp(OwningChar->GetPlayerState()->ExactPing * 0.001f, 0.0f, 1.0f);
+	}
+
+	const float WindowStart = ServerTime - (Latency + VRSettings->ServerPoseHistoryLength);
+	bool bIsValid = true;
+
+	if (!ReplicationData.bServerHasAcceptedMovement)
+	{
+		// Has to have left one of the hands, skip the check if there is no history yet (setting just enabled)
+		bool bHasHistory = false;
+		bool bReachable = false;
+
+		if (OwningChar)
+		{
+			for (const UGripMotionControllerComponent * Hand : { OwningChar->LeftMotionController, OwningChar->RightMotionController })
+			{
+				if (Hand && Hand->ServerPoseHistory.Num() > 0)
+				{
+					bHasHistory = true;
+					bReachable |= Hand->ServerPoseHistory.IsLocationReachable(NewMovement.Location, WindowStart, ServerTime, VRSettings->ClientAuthMaxReleaseDistance, MaxSpeed);
+				}
+			}
+		}
+
+		bIsValid = !bHasHistory || bReachable;
+	}
+	else
+	{
+		const float Elapsed = (ServerTime - ReplicationData.ServerLastAcceptedTime) + Latency;
+		bIsValid = FVector::DistSquared(NewMovement.Location, ReplicationData.ServerLastAcceptedLocation) <= FMath::Square(MaxSpeed * Elapsed);
+	}
+
+	if (!bIsValid)
+	{
+		INC_DWORD_STAT(STAT_ClientAuthMovementRejected);
+		return false;
+	}
+
+	ReplicationData.bServerHasAcceptedMovement = true;
+	ReplicationData.ServerLastAcceptedLocation = NewMovement.Location;
+	ReplicationData.ServerLastAcceptedTime = ServerTime;
+	return true;
+}
+
+void AVRBaseCharacter::FlushClientAuthThrows()
+{
+	bClientAuthThrowFlushPending = false;
+
+	if (PendingClientAuthThrows.Entries.Num() < 1)
+		return;
+
+	if (UWorld * World = GetWorld())
+	{
+		PendingClientAuthThrows.TimeStamp = World->GetTimeSeconds();
+		Server_SendClientAuthThrowBatch(PendingClientAuthThrows);
+	}
+
+	PendingClientAuthThrows.Entries.Reset();
+}
+
+void FVRTrackedPoseFrameTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Target && !Target->IsPendingKill())
+	{
+		Target->FlushTrackedPoseFrame();
+	}
+}
+
+FString FVRTrackedPoseFrameTickFunction::DiagnosticMessage()
+{
+	return Target ? Target->GetFullName() + TEXT("[TrackedPoseFrame]") : TEXT("TrackedPoseFrame");
 }
 
 void AVRBaseCharacter::OnRep_PlayerState()
@@ -112,6 +360,7 @@ void AVRBaseCharacter::GetLifetimeReplicatedProps(TArray< class FLifetimePropert
 	DOREPLIFETIME_CONDITION(AVRBaseCharacter, SeatInformation, COND_None);
 	DOREPLIFETIME_CONDITION(AVRBaseCharacter, VRReplicateCapsuleHeight, COND_None);
 	DOREPLIFETIME_CONDITION(AVRBaseCharacter, ReplicatedCapsuleHeight, COND_SimulatedOnly);
+	DOREPLIFETIME_CONDITION(AVRBaseCharacter, ReplayPoseBatch, COND_ReplayOnly);
 }
 
 void AVRBaseCharacter::PreReplication(IRepChangedPropertyTracker & ChangedPropertyTracker)
@@ -121,6 +370,61 @@ void AVRBaseCharacter::PreReplication(IRepChangedPropertyTracker & ChangedProper
 	DOREPLIFETIME_ACTIVE_OVERRIDE(AVRBaseCharacter, ReplicatedCapsuleHeight, VRReplicateCapsuleHeight);
 }
 
+void AVRBaseCharacter::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (GetDefault<UVRGlobalSettings>()->bUseReplayPoseStream)
+	{
+		TickReplayPoseStream();
+	}
+}
+
+void AVRBaseCharacter::TickReplayPoseStream()
+{
+	UWorld * World = GetWorld();
+	UDemoNetDriver * DemoDriver = World ? World->DemoNetDriver : nullptr;
+
+	if (!DemoDriver)
+		return;
+
+	USceneComponent * PoseComponents[FVRReplayPoseSample::NumPoses] = { VRReplicatedCamera, LeftMotionController, RightMotionController };
+
+	if (DemoDriver->IsRecording())
+	{
+		FVRReplayPoseSample NewSample;
+
+		for (int32 PoseIndex = 0; PoseIndex < FVRReplayPoseSample::NumPoses; ++PoseIndex)
+		{
+			NewSample.Positions[PoseIndex] = PoseComponents[PoseIndex] ? PoseComponents[PoseIndex]->RelativeLocation : FVector::ZeroVector;
+			NewSample.Rotations[PoseIndex] = PoseComponents[PoseIndex] ? PoseComponents[PoseIndex]->RelativeRotation : FRotator::ZeroRotator;
+		}
+
+		ReplayPoseStream.Record(DemoDriver->DemoCurrentTime, NewSample, ReplayPoseBatch);
+	}
+	else if (DemoDriver->IsPlaying())
+	{
+		// Batches arrive once they are complete, so play back a batch length behind
+		FVRReplayPoseSample CurrentSample;
+
+		if (ReplayPoseStream.Sample(DemoDriver->DemoCurrentTime - GetDefault<UVRGlobalSettings>()->ReplayPoseBatchLength, CurrentSample))
+		{
+			for (int32 PoseIndex = 0; PoseIndex < FVRReplayPoseSample::NumPoses; ++PoseIndex)
+			{
+				if (PoseComponents[PoseIndex])
+				{
+					PoseComponents[PoseIndex]->SetRelativeLocationAndRotation(CurrentSample.Positions[PoseIndex], CurrentSample.Rotations[PoseIndex]);
+				}
+			}
+		}
+	}
+}
+
+void AVRBaseCharacter::OnRep_ReplayPoseBatch()
+{
+	ReplayPoseStream.AddBatch(ReplayPoseBatch);
+}
+
 USkeletalMeshComponent* AVRBaseCharacter::GetIKMesh_Implementation() const
 {
 	return nullptr;
@@ -214,6 +518,68 @@ bool AVRBaseCharacter::Server_SendTransformRightController_Validate(FBPVRCompone
 	return true;
 	// Optionally check to make sure that player is inside of their bounds and deny it if they aren't?
 }
+
+void AVRBaseCharacter::Server_SendTrackedPoseFrame_Implementation(FBPVRTrackedPoseFrame NewFrame)
+{
+	// Unreliable, drop anything older than what we already applied
+	if (NewFrame.TimeStamp < LastTrackedPoseFrameTimeStamp)
+		return;
+
+	LastTrackedPoseFrameTimeStamp = NewFrame.TimeStamp;
+
+	if (VRReplicatedCamera && NewFrame.HasPose(FBPVRTrackedPoseFrame::Pose_Camera))
+		VRReplicatedCamera->Server_SendCameraTransform_Implementation(NewFrame.Camera);
+
+	if (LeftMotionController && NewFrame.HasPose(FBPVRTrackedPoseFrame::Pose_LeftController))
+		LeftMotionController->Server_SendControllerTransform_Implementation(NewFrame.LeftController);
+
+	if (RightMotionController && NewFrame.HasPose(FBPVRTrackedPoseFrame::Pose_RightController))
+		RightMotionController->Server_SendControllerTransform_Implementation(NewFrame.RightController);
+}
+
+bool AVRBaseCharacter::Server_SendTrackedPoseFrame_Validate(FBPVRTrackedPoseFrame NewFrame)
+{
+	return true;
+	// Optionally check to make sure that player is inside of their bounds and deny it if they aren't?
+}
+
+void AVRBaseCharacter::Server_SendClientAuthThrowBatch_Implementation(const FVRClientAuthThrowBatch & NewBatch)
+{
+	// Unreliable, drop anything older than what we already applied
+	if (NewBatch.TimeStamp < LastClientAuthThrowBatchTimeStamp)
+		return;
+
+	LastClientAuthThrowBatchTimeStamp = NewBatch.TimeStamp;
+
+	UNetConnection * OwningConnection = GetNetConnection();
+
+	for (const FVRClientAuthThrowEntry & Entry : NewBatch.Entries)
+	{
+		AActor * ThrownActor = Entry.ThrownActor;
+
+		// Same rule as the per actor RPC, only actors owned by the sending connection
+		if (!ThrownActor || ThrownActor->IsPendingKill() || ThrownActor->GetNetConnection() != OwningConnection)
+			continue;
+
+		if (AGrippableActor * GrippableActor = Cast<AGrippableActor>(ThrownActor))
+		{
+			GrippableActor->Server_GetClientAuthReplication_Implementation(Entry.Movement);
+		}
+		else if (AGrippableStaticMeshActor * GrippableStaticMeshActor = Cast<AGrippableStaticMeshActor>(ThrownActor))
+		{
+			GrippableStaticMeshActor->Server_GetClientAuthReplication_Implementation(Entry.Movement);
+		}
+		else if (AGrippableSkeletalMeshActor * GrippableSkeletalMeshActor = Cast<AGrippableSkeletalMeshActor>(ThrownActor))
+		{
+			GrippableSkeletalMeshActor->Server_GetClientAuthReplication_Implementation(Entry.Movement);
+		}
+	}
+}
+
+bool AVRBaseCharacter::Server_SendClientAuthThrowBatch_Validate(const FVRClientAuthThrowBatch & NewBatch)
+{
+	return true;
+}
 FVector AVRBaseCharacter::GetTeleportLocation(FVector OriginalLocation)
 {	
 	return OriginalLocation;
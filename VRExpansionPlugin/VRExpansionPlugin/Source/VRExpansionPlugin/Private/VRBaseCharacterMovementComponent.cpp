@@ -11,6 +11,9 @@
 #include "VRRootComponent.h"
 #include "VRPlayerController.h"
 #include "GameFramework/PhysicsVolume.h"
+#include "VRGlobalSettings.h"
+
+DEFINE_STAT(STAT_VRSavedMovesAllocated);
 
 UVRBaseCharacterMovementComponent::UVRBaseCharacterMovementComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -58,6 +61,8 @@ UVRBaseCharacterMovementComponent::UVRBaseCharacterMovementComponent(const FObje
 
 	bRunControlRotationInMovementComponent = true;
 
+	HMDOnlyMoveCombineWindow = 0.0f;
+
 	// Allow merging dual movements, generally this is wanted for the perf increase
 	bEnableServerDualMoveScopedMovementUpdates = true;
 }
@@ -1183,6 +1188,40 @@ void FSavedMove_VRBaseCharacter::SetInitialPosition(ACharacter* C)
 	FSavedMove_Character::SetInitialPosition(C);
 }
 
+void FNetworkPredictionData_Client_VRBaseCharacter::PreallocateSavedMoves()
+{
+	if (bHasPreallocatedSavedMoves || !GetDefault<UVRGlobalSettings>()->bPreallocateClientSavedMoves)
+		return;
+
+	bHasPreallocatedSavedMoves = true;
+
+	// Every move in SavedMoves plus the pending and the last acked move
+	const int32 PoolSize = MaxSavedMoveCount + 2;
+
+	MaxFreeMoveCount = FMath::Max(MaxFreeMoveCount, PoolSize);
+
+	SavedMoves.Reserve(MaxSavedMoveCount);
+	FreeMoves .Reserve(MaxFreeMoveCount );
+
+	while (FreeMoves.Num() < PoolSize)
+	{
+		FreeMoves.Push(AllocateNewMove());
+	}
+}
+
+bool FSavedMove_VRBaseCharacter::CanCombineHMDOnlyMoves(const FSavedMove_VRBaseCharacter * NewMove, ACharacter * Character) const
+{
+	UVRBaseCharacterMovementComponent * BaseCharMove = Character ? Cast<UVRBaseCharacterMovementComponent>(Character->GetCharacterMovement()) : nullptr;
+
+	if (!BaseCharMove || BaseCharMove->HMDOnlyMoveCombineWindow <= 0.0f)
+		return false;
+
+	if (DeltaTime + NewMove->DeltaTime > BaseCharMove->HMDOnlyMoveCombineWindow)
+		return false;
+
+	return IsHMDOnlyMove() && NewMove->IsHMDOnlyMove();
+}
+
 void FSavedMove_VRBaseCharacter::CombineWith(const FSavedMove_Character* OldMove, ACharacter* InCharacter, APlayerController* PC, const FVector& OldStartLocation)
 {
 	UCharacterMovementComponent* CharMovement = InCharacter->GetCharacterMovement();
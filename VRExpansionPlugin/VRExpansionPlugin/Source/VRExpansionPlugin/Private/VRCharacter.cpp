@@ -206,27 +206,27 @@ bool AVRCharacter::ServerMoveVROld_Validate(float OldTimeStamp, FVector_NetQuant
 	return ((UVRCharacterMovementComponent*)GetCharacterMovement())->ServerMoveVROld_Validate(OldTimeStamp, OldAccel, OldMoveFlags, ConditionalReps);
 }
 
-bool AVRCharacter::ServerMoveVR_Validate(float TimeStamp, FVector_NetQuantize10 InAccel, FVector_NetQuantize100 ClientLoc, FVector_NetQuantize100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantize100 LFDiff, uint16 CapsuleYaw, uint8 MoveFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
+bool AVRCharacter::ServerMoveVR_Validate(float TimeStamp, FVector_NetQuantize10 InAccel, FVector_NetQuantize100 ClientLoc, FVector_NetQuantizeSparse100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantizeSparse100 LFDiff, uint16 CapsuleYaw, uint8 MoveFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
 {
 	return ((UVRCharacterMovementComponent*)GetCharacterMovement())->ServerMoveVR_Validate(TimeStamp, InAccel, ClientLoc, CapsuleLoc, ConditionalReps, LFDiff, CapsuleYaw, MoveFlags, MoveReps, ClientMovementMode);
 }
 
-bool AVRCharacter::ServerMoveVRExLight_Validate(float TimeStamp, FVector_NetQuantize100 ClientLoc, FVector_NetQuantize100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantize100 LFDiff, uint16 CapsuleYaw, uint8 MoveFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
+bool AVRCharacter::ServerMoveVRExLight_Validate(float TimeStamp, FVector_NetQuantize100 ClientLoc, FVector_NetQuantizeSparse100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantizeSparse100 LFDiff, uint16 CapsuleYaw, uint8 MoveFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
 {
 	return ((UVRCharacterMovementComponent*)GetCharacterMovement())->ServerMoveVRExLight_Validate(TimeStamp, ClientLoc, CapsuleLoc, ConditionalReps, LFDiff, CapsuleYaw, MoveFlags, MoveReps, ClientMovementMode);
 }
 
-bool AVRCharacter::ServerMoveVRDual_Validate(float TimeStamp0, FVector_NetQuantize10 InAccel0, uint8 PendingFlags,uint32 View0, FVector_NetQuantize100 OldCapsuleLoc, FVRConditionalMoveRep OldConditionalReps, FVector_NetQuantize100 OldLFDiff, uint16 OldCapsuleYaw, float TimeStamp, FVector_NetQuantize10 InAccel, FVector_NetQuantize100 ClientLoc, FVector_NetQuantize100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantize100 LFDiff, uint16 CapsuleYaw, uint8 NewFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
+bool AVRCharacter::ServerMoveVRDual_Validate(float TimeStamp0, FVector_NetQuantize10 InAccel0, uint8 PendingFlags,uint32 View0, FVector_NetQuantizeSparse100 OldCapsuleLoc, FVRConditionalMoveRep OldConditionalReps, FVector_NetQuantizeSparse100 OldLFDiff, uint16 OldCapsuleYaw, float TimeStamp, FVector_NetQuantize10 InAccel, FVector_NetQuantize100 ClientLoc, FVector_NetQuantizeSparse100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantizeSparse100 LFDiff, uint16 CapsuleYaw, uint8 NewFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
 {
 	return ((UVRCharacterMovementComponent*)GetCharacterMovement())->ServerMoveVRDual_Validate(TimeStamp0, InAccel0, PendingFlags, View0, OldCapsuleLoc, OldConditionalReps, OldLFDiff, OldCapsuleYaw, TimeStamp, InAccel, ClientLoc, CapsuleLoc, ConditionalReps, LFDiff, CapsuleYaw, NewFlags, MoveReps, ClientMovementMode);
 }
 
-bool AVRCharacter::ServerMoveVRDualExLight_Validate(float TimeStamp0, uint8 PendingFlags,uint32 View0, FVector_NetQuantize100 OldCapsuleLoc, FVRConditionalMoveRep OldConditionalReps, FVector_NetQuantize100 OldLFDiff, uint16 OldCapsuleYaw, float TimeStamp, FVector_NetQuantize100 ClientLoc, FVector_NetQuantize100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantize100 LFDiff, uint16 CapsuleYaw, uint8 NewFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
+bool AVRCharacter::ServerMoveVRDualExLight_Validate(float TimeStamp0, uint8 PendingFlags,uint32 View0, FVector_NetQuantizeSparse100 OldCapsuleLoc, FVRConditionalMoveRep OldConditionalReps, FVector_NetQuantizeSparse100 OldLFDiff, uint16 OldCapsuleYaw, float TimeStamp, FVector_NetQuantize100 ClientLoc, FVector_NetQuantizeSparse100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantizeSparse100 LFDiff, uint16 CapsuleYaw, uint8 NewFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
 {
 	return ((UVRCharacterMovementComponent*)GetCharacterMovement())->ServerMoveVRDualExLight_Validate(TimeStamp0, PendingFlags, View0, OldCapsuleLoc, OldConditionalReps, OldLFDiff, OldCapsuleYaw, TimeStamp, ClientLoc, CapsuleLoc, ConditionalReps, LFDiff, CapsuleYaw, NewFlags, MoveReps, ClientMovementMode);
 }
 
-bool AVRCharacter::ServerMoveVRDualHybridRootMotion_Validate(float TimeStamp0, FVector_NetQuantize10 InAccel0, uint8 PendingFlags,uint32 View0, FVector_NetQuantize100 OldCapsuleLoc, FVRConditionalMoveRep OldConditionalReps, FVector_NetQuantize100 OldLFDiff, uint16 OldCapsuleYaw, float TimeStamp, FVector_NetQuantize10 InAccel, FVector_NetQuantize100 ClientLoc, FVector_NetQuantize100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantize100 LFDiff, uint16 CapsuleYaw, uint8 NewFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
+bool AVRCharacter::ServerMoveVRDualHybridRootMotion_Validate(float TimeStamp0, FVector_NetQuantize10 InAccel0, uint8 PendingFlags,uint32 View0, FVector_NetQuantizeSparse100 OldCapsuleLoc, FVRConditionalMoveRep OldConditionalReps, FVector_NetQuantizeSparse100 OldLFDiff, uint16 OldCapsuleYaw, float TimeStamp, FVector_NetQuantize10 InAccel, FVector_NetQuantize100 ClientLoc, FVector_NetQuantizeSparse100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantizeSparse100 LFDiff, uint16 CapsuleYaw, uint8 NewFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
 {
 	return ((UVRCharacterMovementComponent*)GetCharacterMovement())->ServerMoveVRDualHybridRootMotion_Validate(TimeStamp0, InAccel0, PendingFlags, View0, OldCapsuleLoc, OldConditionalReps, OldLFDiff, OldCapsuleYaw, TimeStamp, InAccel, ClientLoc, CapsuleLoc, ConditionalReps, LFDiff, CapsuleYaw, NewFlags, MoveReps, ClientMovementMode);
 }
@@ -236,16 +236,16 @@ void AVRCharacter::ServerMoveVRDualHybridRootMotion_Implementation(
 	FVector_NetQuantize10 InAccel0,
 	uint8 PendingFlags,
 	uint32 View0,
-	FVector_NetQuantize100 OldCapsuleLoc,
+	FVector_NetQuantizeSparse100 OldCapsuleLoc,
 	FVRConditionalMoveRep OldConditionalReps,
-	FVector_NetQuantize100 OldLFDiff,
+	FVector_NetQuantizeSparse100 OldLFDiff,
 	uint16 OldCapsuleYaw,
 	float TimeStamp,
 	FVector_NetQuantize10 InAccel,
 	FVector_NetQuantize100 ClientLoc,
-	FVector_NetQuantize100 CapsuleLoc,
+	FVector_NetQuantizeSparse100 CapsuleLoc,
 	FVRConditionalMoveRep ConditionalReps,
-	FVector_NetQuantize100 LFDiff,
+	FVector_NetQuantizeSparse100 LFDiff,
 	uint16 CapsuleYaw,
 	uint8 NewFlags,
 	FVRConditionalMoveRep2 MoveReps,
@@ -277,16 +277,16 @@ void AVRCharacter::ServerMoveVRDual_Implementation(
 	FVector_NetQuantize10 InAccel0,
 	uint8 PendingFlags,
 	uint32 View0,
-	FVector_NetQuantize100 OldCapsuleLoc,
+	FVector_NetQuantizeSparse100 OldCapsuleLoc,
 	FVRConditionalMoveRep OldConditionalReps,
-	FVector_NetQuantize100 OldLFDiff,
+	FVector_NetQuantizeSparse100 OldLFDiff,
 	uint16 OldCapsuleYaw,
 	float TimeStamp,
 	FVector_NetQuantize10 InAccel,
 	FVector_NetQuantize100 ClientLoc,
-	FVector_NetQuantize100 CapsuleLoc,
+	FVector_NetQuantizeSparse100 CapsuleLoc,
 	FVRConditionalMoveRep ConditionalReps,
-	FVector_NetQuantize100 LFDiff,
+	FVector_NetQuantizeSparse100 LFDiff,
 	uint16 CapsuleYaw,
 	uint8 NewFlags,
 	FVRConditionalMoveRep2 MoveReps,
@@ -317,15 +317,15 @@ void AVRCharacter::ServerMoveVRDualExLight_Implementation(
 	float TimeStamp0,
 	uint8 PendingFlags,
 	uint32 View0,
-	FVector_NetQuantize100 OldCapsuleLoc,
+	FVector_NetQuantizeSparse100 OldCapsuleLoc,
 	FVRConditionalMoveRep OldConditionalReps,
-	FVector_NetQuantize100 OldLFDiff,
+	FVector_NetQuantizeSparse100 OldLFDiff,
 	uint16 OldCapsuleYaw,
 	float TimeStamp,
 	FVector_NetQuantize100 ClientLoc,
-	FVector_NetQuantize100 CapsuleLoc,
+	FVector_NetQuantizeSparse100 CapsuleLoc,
 	FVRConditionalMoveRep ConditionalReps,
-	FVector_NetQuantize100 LFDiff,
+	FVector_NetQuantizeSparse100 LFDiff,
 	uint16 CapsuleYaw,
 	uint8 NewFlags,
 	FVRConditionalMoveRep2 MoveReps,
@@ -353,9 +353,9 @@ void AVRCharacter::ServerMoveVRDualExLight_Implementation(
 void AVRCharacter::ServerMoveVRExLight_Implementation(
 	float TimeStamp,
 	FVector_NetQuantize100 ClientLoc,
-	FVector_NetQuantize100 CapsuleLoc,
+	FVector_NetQuantizeSparse100 CapsuleLoc,
 	FVRConditionalMoveRep ConditionalReps,
-	FVector_NetQuantize100 LFDiff,
+	FVector_NetQuantizeSparse100 LFDiff,
 	uint16 CapsuleYaw,
 	uint8 MoveFlags,
 	FVRConditionalMoveRep2 MoveReps,
@@ -377,9 +377,9 @@ void AVRCharacter::ServerMoveVR_Implementation(
 	float TimeStamp,
 	FVector_NetQuantize10 InAccel,
 	FVector_NetQuantize100 ClientLoc,
-	FVector_NetQuantize100 CapsuleLoc,
+	FVector_NetQuantizeSparse100 CapsuleLoc,
 	FVRConditionalMoveRep ConditionalReps,
-	FVector_NetQuantize100 LFDiff,
+	FVector_NetQuantizeSparse100 LFDiff,
 	uint16 CapsuleYaw,
 	uint8 MoveFlags,
 	FVRConditionalMoveRep2 MoveReps,
@@ -37,6 +37,7 @@ DEFINE_LOG_CATEGORY(LogVRCharacterMovement);
 DECLARE_CYCLE_STAT(TEXT("Char StepUp"), STAT_CharStepUp, STATGROUP_Character);
 DECLARE_CYCLE_STAT(TEXT("Char FindFloor"), STAT_CharFindFloor, STATGROUP_Character);
 DECLARE_CYCLE_STAT(TEXT("Char ReplicateMoveToServer"), STAT_CharacterMovementReplicateMoveToServer, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VR HMD Only Moves Combined"), STAT_VRHMDOnlyMovesCombined, STATGROUP_Character);
 DECLARE_CYCLE_STAT(TEXT("Char CallServerMove"), STAT_CharacterMovementCallServerMove, STATGROUP_Character);
 DECLARE_CYCLE_STAT(TEXT("Char CombineNetMove"), STAT_CharacterMovementCombineNetMove, STATGROUP_Character);
 DECLARE_CYCLE_STAT(TEXT("Char PhysWalking"), STAT_CharPhysWalking, STATGROUP_Character);
@@ -432,27 +433,27 @@ bool UVRCharacterMovementComponent::ServerMoveVROld_Validate(float OldTimeStamp,
 	return true;
 }
 
-bool UVRCharacterMovementComponent::ServerMoveVR_Validate(float TimeStamp, FVector_NetQuantize10 InAccel, FVector_NetQuantize100 ClientLoc, FVector_NetQuantize100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantize100 LFDiff, uint16 CapsuleYaw, uint8 MoveFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
+bool UVRCharacterMovementComponent::ServerMoveVR_Validate(float TimeStamp, FVector_NetQuantize10 InAccel, FVector_NetQuantize100 ClientLoc, FVector_NetQuantizeSparse100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantizeSparse100 LFDiff, uint16 CapsuleYaw, uint8 MoveFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
 {
 	return true;
 }
 
-bool UVRCharacterMovementComponent::ServerMoveVRExLight_Validate(float TimeStamp, FVector_NetQuantize100 ClientLoc, FVector_NetQuantize100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantize100 LFDiff, uint16 CapsuleYaw, uint8 MoveFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
+bool UVRCharacterMovementComponent::ServerMoveVRExLight_Validate(float TimeStamp, FVector_NetQuantize100 ClientLoc, FVector_NetQuantizeSparse100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantizeSparse100 LFDiff, uint16 CapsuleYaw, uint8 MoveFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
 {
 	return true;
 }
 
-bool UVRCharacterMovementComponent::ServerMoveVRDual_Validate(float TimeStamp0, FVector_NetQuantize10 InAccel0, uint8 PendingFlags, uint32 View0, FVector_NetQuantize100 OldCapsuleLoc, FVRConditionalMoveRep OldConditionalReps, FVector_NetQuantize100 OldLFDiff, uint16 OldCapsuleYaw, float TimeStamp, FVector_NetQuantize10 InAccel, FVector_NetQuantize100 ClientLoc, FVector_NetQuantize100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantize100 LFDiff, uint16 CapsuleYaw, uint8 NewFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
+bool UVRCharacterMovementComponent::ServerMoveVRDual_Validate(float TimeStamp0, FVector_NetQuantize10 InAccel0, uint8 PendingFlags, uint32 View0, FVector_NetQuantizeSparse100 OldCapsuleLoc, FVRConditionalMoveRep OldConditionalReps, FVector_NetQuantizeSparse100 OldLFDiff, uint16 OldCapsuleYaw, float TimeStamp, FVector_NetQuantize10 InAccel, FVector_NetQuantize100 ClientLoc, FVector_NetQuantizeSparse100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantizeSparse100 LFDiff, uint16 CapsuleYaw, uint8 NewFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
 {
 	return true;
 }
 
-bool UVRCharacterMovementComponent::ServerMoveVRDualExLight_Validate(float TimeStamp0, uint8 PendingFlags, uint32 View0, FVector_NetQuantize100 OldCapsuleLoc, FVRConditionalMoveRep OldConditionalReps, FVector_NetQuantize100 OldLFDiff, uint16 OldCapsuleYaw, float TimeStamp, FVector_NetQuantize100 ClientLoc, FVector_NetQuantize100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantize100 LFDiff, uint16 CapsuleYaw, uint8 NewFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
+bool UVRCharacterMovementComponent::ServerMoveVRDualExLight_Validate(float TimeStamp0, uint8 PendingFlags, uint32 View0, FVector_NetQuantizeSparse100 OldCapsuleLoc, FVRConditionalMoveRep OldConditionalReps, FVector_NetQuantizeSparse100 OldLFDiff, uint16 OldCapsuleYaw, float TimeStamp, FVector_NetQuantize100 ClientLoc, FVector_NetQuantizeSparse100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantizeSparse100 LFDiff, uint16 CapsuleYaw, uint8 NewFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
 {
 	return true;
 }
 
-bool UVRCharacterMovementComponent::ServerMoveVRDualHybridRootMotion_Validate(float TimeStamp0, FVector_NetQuantize10 InAccel0, uint8 PendingFlags,  uint32 View0, FVector_NetQuantize100 OldCapsuleLoc, FVRConditionalMoveRep OldConditionalReps, FVector_NetQuantize100 OldLFDiff, uint16 OldCapsuleYaw, float TimeStamp, FVector_NetQuantize10 InAccel, FVector_NetQuantize100 ClientLoc, FVector_NetQuantize100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantize100 LFDiff, uint16 CapsuleYaw, uint8 NewFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
+bool UVRCharacterMovementComponent::ServerMoveVRDualHybridRootMotion_Validate(float TimeStamp0, FVector_NetQuantize10 InAccel0, uint8 PendingFlags,  uint32 View0, FVector_NetQuantizeSparse100 OldCapsuleLoc, FVRConditionalMoveRep OldConditionalReps, FVector_NetQuantizeSparse100 OldLFDiff, uint16 OldCapsuleYaw, float TimeStamp, FVector_NetQuantize10 InAccel, FVector_NetQuantize100 ClientLoc, FVector_NetQuantizeSparse100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantizeSparse100 LFDiff, uint16 CapsuleYaw, uint8 NewFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
 {
 	return true;
 }
@@ -462,16 +463,16 @@ void UVRCharacterMovementComponent::ServerMoveVRDualHybridRootMotion_Implementat
 	FVector_NetQuantize10 InAccel0,
 	uint8 PendingFlags,
 	uint32 View0,
-	FVector_NetQuantize100 OldCapsuleLoc,
+	FVector_NetQuantizeSparse100 OldCapsuleLoc,
 	FVRConditionalMoveRep OldConditionalReps,
-	FVector_NetQuantize100 OldLFDiff,
+	FVector_NetQuantizeSparse100 OldLFDiff,
 	uint16 OldCapsuleYaw,
 	float TimeStamp,
 	FVector_NetQuantize10 InAccel,
 	FVector_NetQuantize100 ClientLoc,
-	FVector_NetQuantize100 CapsuleLoc,
+	FVector_NetQuantizeSparse100 CapsuleLoc,
 	FVRConditionalMoveRep ConditionalReps,
-	FVector_NetQuantize100 LFDiff,
+	FVector_NetQuantizeSparse100 LFDiff,
 	uint16 CapsuleYaw,
 	uint8 NewFlags,
 	FVRConditionalMoveRep2 MoveReps,
@@ -499,16 +500,16 @@ void UVRCharacterMovementComponent::ServerMoveVRDual_Implementation(
 	FVector_NetQuantize10 InAccel0,
 	uint8 PendingFlags,
 	uint32 View0,
-	FVector_NetQuantize100 OldCapsuleLoc, 
+	FVector_NetQuantizeSparse100 OldCapsuleLoc, 
 	FVRConditionalMoveRep OldConditionalReps,
-	FVector_NetQuantize100 OldLFDiff,
+	FVector_NetQuantizeSparse100 OldLFDiff,
 	uint16 OldCapsuleYaw,
 	float TimeStamp,
 	FVector_NetQuantize10 InAccel,
 	FVector_NetQuantize100 ClientLoc,
-	FVector_NetQuantize100 CapsuleLoc,
+	FVector_NetQuantizeSparse100 CapsuleLoc,
 	FVRConditionalMoveRep ConditionalReps,
-	FVector_NetQuantize100 LFDiff,
+	FVector_NetQuantizeSparse100 LFDiff,
 	uint16 CapsuleYaw,
 	uint8 NewFlags,
 	FVRConditionalMoveRep2 MoveReps,
@@ -531,15 +532,15 @@ void UVRCharacterMovementComponent::ServerMoveVRDualExLight_Implementation(
 	float TimeStamp0,
 	uint8 PendingFlags,
 	uint32 View0,
-	FVector_NetQuantize100 OldCapsuleLoc,
+	FVector_NetQuantizeSparse100 OldCapsuleLoc,
 	FVRConditionalMoveRep OldConditionalReps,
-	FVector_NetQuantize100 OldLFDiff,
+	FVector_NetQuantizeSparse100 OldLFDiff,
 	uint16 OldCapsuleYaw,
 	float TimeStamp,
 	FVector_NetQuantize100 ClientLoc,
-	FVector_NetQuantize100 CapsuleLoc,
+	FVector_NetQuantizeSparse100 CapsuleLoc,
 	FVRConditionalMoveRep ConditionalReps,
-	FVector_NetQuantize100 LFDiff,
+	FVector_NetQuantizeSparse100 LFDiff,
 	uint16 CapsuleYaw,
 	uint8 NewFlags,
 	FVRConditionalMoveRep2 MoveReps,
@@ -561,9 +562,9 @@ void UVRCharacterMovementComponent::ServerMoveVRDualExLight_Implementation(
 void UVRCharacterMovementComponent::ServerMoveVRExLight_Implementation(
 	float TimeStamp,
 	FVector_NetQuantize100 ClientLoc,
-	FVector_NetQuantize100 CapsuleLoc,
+	FVector_NetQuantizeSparse100 CapsuleLoc,
 	FVRConditionalMoveRep ConditionalReps,
-	FVector_NetQuantize100 LFDiff,
+	FVector_NetQuantizeSparse100 LFDiff,
 	uint16 CapsuleYaw,
 	uint8 MoveFlags,
 	FVRConditionalMoveRep2 MoveReps,
@@ -648,9 +649,9 @@ void UVRCharacterMovementComponent::ServerMoveVR_Implementation(
 	float TimeStamp,
 	FVector_NetQuantize10 InAccel,
 	FVector_NetQuantize100 ClientLoc,
-	FVector_NetQuantize100 CapsuleLoc,
+	FVector_NetQuantizeSparse100 CapsuleLoc,
 	FVRConditionalMoveRep ConditionalReps,
-	FVector_NetQuantize100 LFDiff,
+	FVector_NetQuantizeSparse100 LFDiff,
 	uint16 CapsuleYaw,
 	uint8 MoveFlags,
 	FVRConditionalMoveRep2 MoveReps,
@@ -983,27 +984,27 @@ void UVRCharacterMovementComponent::ServerMoveVROld(float OldTimeStamp, FVector_
 	((AVRCharacter*)CharacterOwner)->ServerMoveVROld(OldTimeStamp, OldAccel, OldMoveFlags,ConditionalReps);
 }
 
-void UVRCharacterMovementComponent::ServerMoveVR(float TimeStamp, FVector_NetQuantize10 InAccel, FVector_NetQuantize100 ClientLoc, FVector_NetQuantize100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantize100 LFDiff, uint16 CapsuleYaw, uint8 CompressedMoveFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
+void UVRCharacterMovementComponent::ServerMoveVR(float TimeStamp, FVector_NetQuantize10 InAccel, FVector_NetQuantize100 ClientLoc, FVector_NetQuantizeSparse100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantizeSparse100 LFDiff, uint16 CapsuleYaw, uint8 CompressedMoveFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
 {
 	((AVRCharacter*)CharacterOwner)->ServerMoveVR(TimeStamp, InAccel, ClientLoc, CapsuleLoc, ConditionalReps, LFDiff, CapsuleYaw, CompressedMoveFlags, MoveReps, ClientMovementMode);
 }
 
-void UVRCharacterMovementComponent::ServerMoveVRExLight(float TimeStamp, FVector_NetQuantize100 ClientLoc, FVector_NetQuantize100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantize100 LFDiff, uint16 CapsuleYaw, uint8 CompressedMoveFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
+void UVRCharacterMovementComponent::ServerMoveVRExLight(float TimeStamp, FVector_NetQuantize100 ClientLoc, FVector_NetQuantizeSparse100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantizeSparse100 LFDiff, uint16 CapsuleYaw, uint8 CompressedMoveFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
 {
 	((AVRCharacter*)CharacterOwner)->ServerMoveVRExLight(TimeStamp, ClientLoc, CapsuleLoc, ConditionalReps, LFDiff, CapsuleYaw, CompressedMoveFlags, MoveReps, ClientMovementMode);
 }
 
-void UVRCharacterMovementComponent::ServerMoveVRDual(float TimeStamp0, FVector_NetQuantize10 InAccel0, uint8 PendingFlags, uint32 View0, FVector_NetQuantize100 OldCapsuleLoc, FVRConditionalMoveRep OldConditionalReps, FVector_NetQuantize100 OldLFDiff, uint16 OldCapsuleYaw, float TimeStamp, FVector_NetQuantize10 InAccel, FVector_NetQuantize100 ClientLoc, FVector_NetQuantize100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantize100 LFDiff, uint16 CapsuleYaw, uint8 NewFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
+void UVRCharacterMovementComponent::ServerMoveVRDual(float TimeStamp0, FVector_NetQuantize10 InAccel0, uint8 PendingFlags, uint32 View0, FVector_NetQuantizeSparse100 OldCapsuleLoc, FVRConditionalMoveRep OldConditionalReps, FVector_NetQuantizeSparse100 OldLFDiff, uint16 OldCapsuleYaw, float TimeStamp, FVector_NetQuantize10 InAccel, FVector_NetQuantize100 ClientLoc, FVector_NetQuantizeSparse100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantizeSparse100 LFDiff, uint16 CapsuleYaw, uint8 NewFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
 {
 	((AVRCharacter*)CharacterOwner)->ServerMoveVRDual(TimeStamp0, InAccel0, PendingFlags, View0, OldCapsuleLoc, OldConditionalReps, OldLFDiff, OldCapsuleYaw, TimeStamp, InAccel, ClientLoc, CapsuleLoc, ConditionalReps, LFDiff, CapsuleYaw, NewFlags, MoveReps, ClientMovementMode);
 }
 
-void UVRCharacterMovementComponent::ServerMoveVRDualExLight(float TimeStamp0, uint8 PendingFlags, uint32 View0, FVector_NetQuantize100 OldCapsuleLoc, FVRConditionalMoveRep OldConditionalReps, FVector_NetQuantize100 OldLFDiff, uint16 OldCapsuleYaw, float TimeStamp, FVector_NetQuantize100 ClientLoc, FVector_NetQuantize100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantize100 LFDiff, uint16 CapsuleYaw, uint8 NewFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
+void UVRCharacterMovementComponent::ServerMoveVRDualExLight(float TimeStamp0, uint8 PendingFlags, uint32 View0, FVector_NetQuantizeSparse100 OldCapsuleLoc, FVRConditionalMoveRep OldConditionalReps, FVector_NetQuantizeSparse100 OldLFDiff, uint16 OldCapsuleYaw, float TimeStamp, FVector_NetQuantize100 ClientLoc, FVector_NetQuantizeSparse100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantizeSparse100 LFDiff, uint16 CapsuleYaw, uint8 NewFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
 {
 	((AVRCharacter*)CharacterOwner)->ServerMoveVRDualExLight(TimeStamp0, PendingFlags, View0, OldCapsuleLoc, OldConditionalReps, OldLFDiff, OldCapsuleYaw, TimeStamp, ClientLoc, CapsuleLoc, ConditionalReps, LFDiff, CapsuleYaw, NewFlags, MoveReps, ClientMovementMode);
 }
 
-void UVRCharacterMovementComponent::ServerMoveVRDualHybridRootMotion(float TimeStamp0, FVector_NetQuantize10 InAccel0, uint8 PendingFlags, uint32 View0, FVector_NetQuantize100 OldCapsuleLoc, FVRConditionalMoveRep OldConditionalReps, FVector_NetQuantize100 OldLFDiff, uint16 OldCapsuleYaw, float TimeStamp, FVector_NetQuantize10 InAccel, FVector_NetQuantize100 ClientLoc, FVector_NetQuantize100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantize100 LFDiff, uint16 CapsuleYaw, uint8 NewFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
+void UVRCharacterMovementComponent::ServerMoveVRDualHybridRootMotion(float TimeStamp0, FVector_NetQuantize10 InAccel0, uint8 PendingFlags, uint32 View0, FVector_NetQuantizeSparse100 OldCapsuleLoc, FVRConditionalMoveRep OldConditionalReps, FVector_NetQuantizeSparse100 OldLFDiff, uint16 OldCapsuleYaw, float TimeStamp, FVector_NetQuantize10 InAccel, FVector_NetQuantize100 ClientLoc, FVector_NetQuantizeSparse100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantizeSparse100 LFDiff, uint16 CapsuleYaw, uint8 NewFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode)
 {
 	((AVRCharacter*)CharacterOwner)->ServerMoveVRDualHybridRootMotion(TimeStamp0, InAccel0, PendingFlags, View0, OldCapsuleLoc, OldConditionalReps, OldLFDiff, OldCapsuleYaw, TimeStamp, InAccel, ClientLoc, CapsuleLoc, ConditionalReps, LFDiff, CapsuleYaw, NewFlags, MoveReps, ClientMovementMode);
 }
@@ -1362,6 +1363,9 @@ void UVRCharacterMovementComponent::ReplicateMoveToServer(float DeltaTime, const
 		return;
 	}
 
+	// Only the locally controlled client gets here, so only it fills its saved move pool
+	static_cast<FNetworkPredictionData_Client_VRBaseCharacter*>(ClientData)->PreallocateSavedMoves();
+
 	// Update our delta time for physics simulation.
 	DeltaTime = ClientData->UpdateTimeStampAndDeltaTime(DeltaTime, *CharacterOwner, *this);
 
@@ -1421,6 +1425,13 @@ void UVRCharacterMovementComponent::ReplicateMoveToServer(float DeltaTime, const
 				FVRCharacterScopedMovementUpdate ScopedMovementUpdate(UpdatedComponent, EScopedUpdate::DeferredUpdates);
 				UE_LOG(LogVRCharacterMovement, VeryVerbose, TEXT("CombineMove: add delta %f + %f and revert from %f %f to %f %f"), DeltaTime, ClientData->PendingMove->DeltaTime, UpdatedComponent->GetComponentLocation().X, UpdatedComponent->GetComponentLocation().Y, /*OldStartLocation.X*/OverlapLocation.X, /*OldStartLocation.Y*/OverlapLocation.Y);
 
+#if STATS
+				if (((const FSavedMove_VRBaseCharacter*)PendingMove)->IsHMDOnlyMove() && ((const FSavedMove_VRBaseCharacter*)NewMove)->IsHMDOnlyMove())
+				{
+					INC_DWORD_STAT(STAT_VRHMDOnlyMovesCombined);
+				}
+#endif
+
 				NewMove->CombineWith(PendingMove, CharacterOwner, PC, OldStartLocation);
 
 				/************************/
@@ -1479,7 +1490,13 @@ void UVRCharacterMovementComponent::ReplicateMoveToServer(float DeltaTime, const
 		{
 			// Decide whether to hold off on move	
 			// Decide whether to hold off on move
-			const float NetMoveDelta = FMath::Clamp(GetClientNetSendDeltaTime(PC, ClientData, NewMovePtr), 1.f / 120.f, 1.f / 5.f);
+			float NetMoveDelta = FMath::Clamp(GetClientNetSendDeltaTime(PC, ClientData, NewMovePtr), 1.f / 120.f, 1.f / 5.f);
+
+			// Hold HMD only moves longer so that they combine, the next move with locomotion input won't combine and flushes it
+			if (HMDOnlyMoveCombineWindow > 0.0f && ((const FSavedMove_VRBaseCharacter*)NewMove)->IsHMDOnlyMove())
+			{
+				NetMoveDelta = FMath::Max(NetMoveDelta, FMath::Min(HMDOnlyMoveCombineWindow, ClientData->MaxMoveDeltaTime));
+			}
 			
 			if ((MyWorld->TimeSeconds - ClientData->ClientUpdateTime) * MyWorld->GetWorldSettings()->GetEffectiveTimeDilation() < NetMoveDelta)
 			{
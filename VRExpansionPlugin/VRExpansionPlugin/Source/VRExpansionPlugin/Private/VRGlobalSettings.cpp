@@ -6,6 +6,37 @@ UVRGlobalSettings::UVRGlobalSettings(const FObjectInitializer& ObjectInitializer
 	OneEuroMinCutoff                      (2.0f                ),
 	OneEuroCutoffSlope                    (0.007f              ),
 	OneEuroDeltaCutoff                    (1.0f                ),
+	MaxPooledPhysicsHandles               (16                  ),
+	bUseGripLOD                           (false               ),
+	GripLODDistance                       (3000.0f             ),
+	GripLODNotRenderedTime                (1.0f                ),
+	GripLODUpdateRate                     (10.0f               ),
+	bUsePoseSnapshotBuffer                (false               ),
+	PoseSnapshotBufferSize                (32                  ),
+	PoseSnapshotInterpolationDelay        (0.1f                ),
+	PoseSnapshotMaxExtrapolationTime      (0.1f                ),
+	bUseAdaptiveNetUpdateRate             (false               ),
+	AdaptiveNetUpdateMinRate              (20.0f               ),
+	AdaptiveNetUpdateLinearVelocity       (100.0f              ),
+	AdaptiveNetUpdateAngularVelocity      (180.0f              ),
+	AdaptiveNetUpdateBandwidthFraction    (0.25f               ),
+	bValidateClientAuthMovement           (false               ),
+	ServerPoseHistoryMaxSamples           (64                  ),
+	ServerPoseHistoryLength               (0.25f               ),
+	ClientAuthMaxThrowSpeed               (5000.0f             ),
+	ClientAuthMaxReleaseDistance          (150.0f              ),
+	PhysicsReplicationMaxTargetsPerTick   (0                   ),
+	PhysicsReplicationMaxTickTimeMs       (0.0f                ),
+	PhysicsReplicationMaxPingCompensation (0.25f               ),
+	bUseAutoNetDormancy                   (false               ),
+	AutoDormancyCheckRate                 (2                   ),
+	AutoDormancyRestTime                  (2.0f                ),
+	RecentInteractionPriorityTime         (2.0f                ),
+	RecentInteractionPriorityScale        (2.0f                ),
+	bUseReplayPoseStream                  (false               ),
+	ReplayPoseSampleRate                  (30                  ),
+	ReplayPoseBatchLength                 (0.5f                ),
+	bPreallocateClientSavedMoves          (false               ),
 	CurrentControllerProfileInUse         (NAME_None           ),
 	CurrentControllerProfileTransform     (FTransform::Identity),
 	bUseSeperateHandTransforms            (false               ),
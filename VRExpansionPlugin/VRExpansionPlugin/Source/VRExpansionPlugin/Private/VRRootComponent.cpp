@@ -33,6 +33,12 @@ DEFINE_LOG_CATEGORY(LogVRRootComponent);
 #define PERF_MOVECOMPONENT_STATS 0
 
 DECLARE_CYCLE_STAT(TEXT("VRRootMovement"), STAT_VRRootMovement, STATGROUP_VRRootComponent);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Relative Movement Sweeps Issued"), STAT_RelativeMovementSweepsIssued, STATGROUP_VRRootComponent);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Relative Movement Sweeps Skipped"), STAT_RelativeMovementSweepsSkipped, STATGROUP_VRRootComponent);
+DECLARE_CYCLE_STAT(TEXT("VRRoot UpdateOverlaps"), STAT_VRRootUpdateOverlaps, STATGROUP_VRRootComponent);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Incremental Overlap Refreshes"), STAT_IncrementalOverlapRefreshes, STATGROUP_VRRootComponent);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Incremental Overlap Reuses"), STAT_IncrementalOverlapReuses, STATGROUP_VRRootComponent);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Incremental Overlap Fallbacks"), STAT_IncrementalOverlapFallbacks, STATGROUP_VRRootComponent);
 
 
 
@@ -195,6 +201,68 @@ static bool ShouldIgnoreOverlapResult
 
 // End of Static Functions
 
+// Strict ordering of overlaps by component and body, stale entries (null components) sort first.
+FORCEINLINE_DEBUGGABLE static bool OverlapInfoLess(const FOverlapInfo& A, const FOverlapInfo& B)
+{
+	const UPTRINT CompA = (UPTRINT)A.OverlapInfo.Component.Get();
+	const UPTRINT CompB = (UPTRINT)B.OverlapInfo.Component.Get();
+
+	return CompA != CompB ? CompA < CompB : A.GetBodyIndex() < B.GetBodyIndex();
+}
+
+/*
+Sorts both lists and removes the entries they have in common in a single merge pass, without allocating.
+OldOverlaps is left with the overlaps that ended and NewOverlaps with the ones that began.
+*/
+template<class AllocatorType>
+static void RemoveCommonOverlapsSorted(TArray<FOverlapInfo, AllocatorType>& OldOverlaps, TArray<FOverlapInfo, AllocatorType>& NewOverlaps)
+{
+	OldOverlaps.Sort(&OverlapInfoLess);
+	NewOverlaps.Sort(&OverlapInfoLess);
+
+	int32 OldIdx = 0, NewIdx = 0, OldWrite = 0, NewWrite = 0;
+
+	while (OldIdx < OldOverlaps.Num() && NewIdx < NewOverlaps.Num())
+	{
+		if (OverlapInfoLess(OldOverlaps[OldIdx], NewOverlaps[NewIdx]))
+		{
+			OldOverlaps[OldWrite++] = OldOverlaps[OldIdx++];
+		}
+		else if (OverlapInfoLess(NewOverlaps[NewIdx], OldOverlaps[OldIdx]))
+		{
+			NewOverlaps[NewWrite++] = NewOverlaps[NewIdx++];
+		}
+		else
+		{
+			// Stale entries compare equal to each other, only drop real matches
+			if (OldOverlaps[OldIdx].OverlapInfo.Component.IsValid())
+			{
+				++OldIdx;
+				++NewIdx;
+			}
+			else
+			{
+				OldOverlaps[OldWrite++] = OldOverlaps[OldIdx++];
+			}
+		}
+	}
+
+	while (OldIdx < OldOverlaps.Num())
+	{
+		OldOverlaps[OldWrite++] = OldOverlaps[OldIdx++];
+	}
+
+	while (NewIdx < NewOverlaps.Num())
+	{
+		NewOverlaps[NewWrite++] = NewOverlaps[NewIdx++];
+	}
+
+	const bool bAllowShrinking = false;
+
+	OldOverlaps.SetNum(OldWrite, bAllowShrinking);
+	NewOverlaps.SetNum(NewWrite, bAllowShrinking);
+}
+
 // Helper for adding an FOverlapInfo uniquely to an Array, using IndexOfOverlapFast and knowing that at least one overlap is valid (non-null).
 template<class AllocatorType>
 FORCEINLINE_DEBUGGABLE void AddUniqueOverlapFast(TArray<FOverlapInfo, AllocatorType>& OverlapArray, FOverlapInfo& NewOverlap)
@@ -231,6 +299,10 @@ FORCEINLINE_DEBUGGABLE int32 IndexOfOverlapFast(const TArray<FOverlapInfo, Alloc
 UVRRootComponent::UVRRootComponent(const FObjectInitializer& ObjectInitializer) :
 	Super                       (ObjectInitializer                                                            ),
 	BCalledUpdateTransform      (false                                                                        ),
+	SweepBroadphaseBounds       (ForceInit                                                                    ),
+	SweepBroadphaseRefreshTime  (0.0f                                                                         ),
+	BSweepBroadphaseHasBlockers (false                                                                        ),
+	OverlapCandidateBounds      (ForceInit                                                                    ),
 	OwningVRChar                (NULL                                                                         ),
 	DifferenceFromLastFrame     (FVector::ZeroVector                                                          ),
 	OffsetComponentToWorld      (FTransform(FQuat(0.0f, 0.0f, 0.0f, 1.0f), FVector::ZeroVector, FVector(1.0f))),
@@ -245,7 +317,13 @@ UVRRootComponent::UVRRootComponent(const FObjectInitializer& ObjectInitializer)
 	BCenterCapsuleOnHMD         (false                                                                        ),
 	BAllowSimulatingCollision   (false                                                                        ),
 	BUseWalkingCollisionOverride(false                                                                        ),
-	WalkingCollisionOverride    (ECollisionChannel::ECC_Pawn                                                  )
+	WalkingCollisionOverride    (ECollisionChannel::ECC_Pawn                                                  ),
+	BUseSweepBroadphaseCache    (false                                                                        ),
+	SweepBroadphaseInflation    (50.0f                                                                        ),
+	SweepBroadphaseRefreshRate  (4.0f                                                                         ),
+	BUseIncrementalOverlaps     (false                                                                        ),
+	IncrementalOverlapInflation (25.0f                                                                        ),
+	IncrementalOverlapMaxTests  (8                                                                            )
 {
 	PrimaryComponentTick.bCanEverTick          = true         ;
 	PrimaryComponentTick.bStartWithTickEnabled = true         ;
@@ -516,8 +594,15 @@ void UVRRootComponent::TickComponent(float DeltaTime, enum ELevelTick TickType,
 					}
 				}
 
+				if (bAllowWalkingCollision && BUseSweepBroadphaseCache && !SweepBroadphaseMayBlock(LastPosition, OffsetComponentToWorld.GetLocation(), Params, ResponseParam))
+				{
+					INC_DWORD_STAT(STAT_RelativeMovementSweepsSkipped);
+					bAllowWalkingCollision = false;
+				}
+
 				if (bAllowWalkingCollision)
 				{
+					INC_DWORD_STAT(STAT_RelativeMovementSweepsIssued);
 					bBlockingHit = GetWorld()->SweepSingleByChannel(OutHit, LastPosition, OffsetComponentToWorld.GetLocation()/*NextTransform.GetLocation()*/, FQuat::Identity, WalkingCollisionOverride, GetCollisionShape(), Params, ResponseParam);
 				}
 
@@ -1196,11 +1281,54 @@ void UVRRootComponent::SendPhysicsTransform(ETeleportType Teleport)
 
 
 
+bool UVRRootComponent::SweepBroadphaseMayBlock(const FVector & Start, const FVector & End, const FCollisionQueryParams & Params, const FCollisionResponseParams & ResponseParam)
+{
+	UWorld * World = GetWorld();
+
+	if (!World)
+		return true;
+
+	const FVector ShapeExtent = GetCollisionShape().GetExtent();
+	const FBox    SweptBounds = FBox(Start.ComponentMin(End) - ShapeExtent, Start.ComponentMax(End) + ShapeExtent);
+	const float   CurrentTime = World->GetTimeSeconds();
+
+	// Only inflated horizontally, and the bottom sits above the floor the capsule is hovering on (walking keeps it
+	// between MIN_FLOOR_DIST and MAX_FLOOR_DIST up) so that the ground under us never counts as a blocker
+	const float   Inflation   = FMath::Max(SweepBroadphaseInflation, 0.0f);
+	const float   FloorOffset = UCharacterMovementComponent::MAX_FLOOR_DIST;
+
+	// Re-check when stale or when the capsule has left the region that was checked
+	const bool bLeftRegion =
+		!SweepBroadphaseBounds.IsValid                 ||
+		!SweepBroadphaseBounds.IsInsideXY(SweptBounds) ||
+		SweptBounds.Max.Z > SweepBroadphaseBounds.Max.Z ||
+		!FMath::IsNearlyEqual(SweptBounds.Min.Z + FloorOffset, SweepBroadphaseBounds.Min.Z, FloorOffset);
+
+	if (bLeftRegion || CurrentTime >= SweepBroadphaseRefreshTime)
+	{
+		SweepBroadphaseBounds       = FBox(SweptBounds.Min - FVector(Inflation, Inflation, 0.0f), SweptBounds.Max + FVector(Inflation, Inflation, 0.0f));
+		SweepBroadphaseBounds.Min.Z = FMath::Min(SweptBounds.Min.Z + FloorOffset, SweptBounds.Max.Z);
+		SweepBroadphaseRefreshTime  = CurrentTime + (1.0f / FMath::Max(SweepBroadphaseRefreshRate, 0.1f));
+		BSweepBroadphaseHasBlockers = World->OverlapBlockingTestByChannel(SweepBroadphaseBounds.GetCenter(), FQuat::Identity, WalkingCollisionOverride, FCollisionShape::MakeBox(SweepBroadphaseBounds.GetExtent()), Params, ResponseParam);
+	}
+
+	return BSweepBroadphaseHasBlockers;
+}
+
+
+
 bool UVRRootComponent::UpdateOverlapsImpl(const TArray<FOverlapInfo>* NewPendingOverlaps, bool bDoNotifies, const TArray<FOverlapInfo>* OverlapsAtEndLocation)
 {
-	//SCOPE_CYCLE_COUNTER(STAT_UpdateOverlaps);
+	SCOPE_CYCLE_COUNTER(STAT_VRRootUpdateOverlaps);
 	bool bCanSkipUpdateOverlaps = true;
 
+	// Something new is touching the capsule, re-check the relative movement sweep blockers next tick and the overlap candidates now
+	if (NewPendingOverlaps && NewPendingOverlaps->Num() > 0)
+	{
+		SweepBroadphaseBounds .Init();
+		OverlapCandidateBounds.Init();
+	}
+
 	// First, dispatch any pending overlaps.
 	if (GetGenerateOverlapEvents() && IsQueryCollisionEnabled())	//TODO: should modifying query collision remove from mayoverlapevents?
 	{
@@ -1268,6 +1396,10 @@ bool UVRRootComponent::UpdateOverlapsImpl(const TArray<FOverlapInfo>* NewPending
 						NewOverlappingComponents.RemoveAllSwap(FPredicateFilterCannotOverlap(*this), false);
 					}
 				}
+				else if (BUseIncrementalOverlaps && GatherIncrementalOverlaps(NewOverlappingComponents, bIgnoreChildren))
+				{
+					UE_LOG(LogVRRootComponent, VeryVerbose, TEXT("%s->%s Incremental overlaps!"), *GetNameSafe(GetOwner()), *GetName());
+				}
 				else
 				{
 					UE_LOG(LogVRRootComponent, VeryVerbose, TEXT("%s->%s Performing overlaps!"), *GetNameSafe(GetOwner()), *GetName());
@@ -1323,21 +1455,28 @@ bool UVRRootComponent::UpdateOverlapsImpl(const TArray<FOverlapInfo>* NewPending
 				We do this by removing common entries from both lists, since overlapping status has not changed for them.
 				What is left over will be what has changed.
 				*/
-				for (int32 CompIdx = 0; CompIdx < OldOverlappingComponents.Num() && NewOverlappingComponents.Num() > 0; ++CompIdx)
+				if (BUseIncrementalOverlaps)
 				{
-					// RemoveSingleSwap is ok, since it is not necessary to maintain order.
-					const bool bAllowShrinking = false;
+					RemoveCommonOverlapsSorted(OldOverlappingComponents, NewOverlappingComponents);
+				}
+				else
+				{
+					for (int32 CompIdx = 0; CompIdx < OldOverlappingComponents.Num() && NewOverlappingComponents.Num() > 0; ++CompIdx)
+					{
+						// RemoveSingleSwap is ok, since it is not necessary to maintain order.
+						const bool bAllowShrinking = false;
 
 
-					const FOverlapInfo& SearchItem    = OldOverlappingComponents[CompIdx]                       ;
-					const int32         NewElementIdx = IndexOfOverlapFast(NewOverlappingComponents, SearchItem);
+						const FOverlapInfo& SearchItem    = OldOverlappingComponents[CompIdx]                       ;
+						const int32         NewElementIdx = IndexOfOverlapFast(NewOverlappingComponents, SearchItem);
 
-					if (NewElementIdx != INDEX_NONE)
-					{
-						NewOverlappingComponents.RemoveAtSwap(NewElementIdx, 1, bAllowShrinking);
-						OldOverlappingComponents.RemoveAtSwap(CompIdx      , 1, bAllowShrinking);
+						if (NewElementIdx != INDEX_NONE)
+						{
+							NewOverlappingComponents.RemoveAtSwap(NewElementIdx, 1, bAllowShrinking);
+							OldOverlappingComponents.RemoveAtSwap(CompIdx      , 1, bAllowShrinking);
 
-						--CompIdx;
+							--CompIdx;
+						}
 					}
 				}
 
@@ -1410,4 +1549,95 @@ bool UVRRootComponent::UpdateOverlapsImpl(const TArray<FOverlapInfo>* NewPending
 	return bCanSkipUpdateOverlaps;
 }
 
+
+bool UVRRootComponent::GatherIncrementalOverlaps(TArray<FOverlapInfo, TInlineAllocator<3>>& OutOverlaps, bool bIgnoreChildren)
+{
+	AActor* const MyActor = GetOwner();
+	UWorld* const MyWorld = GetWorld();
+
+	if (!MyActor || !MyWorld)
+		return false;
+
+	const FVector         OverlapLocation = OffsetComponentToWorld.GetTranslation();
+	const FQuat           OverlapRotation = GetComponentQuat();
+	const FCollisionShape OverlapShape    = GetCollisionShape();
+	const FVector         OverlapExtent   = FVector(OverlapShape.GetExtent().GetMax());
+	const FBox            CapsuleBounds   = FBox(OverlapLocation - OverlapExtent, OverlapLocation + OverlapExtent);
+
+	if (!OverlapCandidateBounds.IsValid || !OverlapCandidateBounds.IsInside(CapsuleBounds))
+	{
+		INC_DWORD_STAT(STAT_IncrementalOverlapRefreshes);
+
+		OverlapCandidateBounds = CapsuleBounds.ExpandBy(FMath::Max(IncrementalOverlapInflation, 0.0f));
+		OverlapCandidates.Reset();
+
+		TArray<FOverlapResult> Overlaps;
+
+		FComponentQueryParams Params(SCENE_QUERY_STAT(UpdateOverlaps), bIgnoreChildren ? MyActor : nullptr);
+		
+		Params.bIgnoreBlocks = true;   //We don't care about blockers since we only route overlap events to real overlaps.
+
+		FCollisionResponseParams ResponseParam;
+
+		InitSweepCollisionParams(Params, ResponseParam);
+
+		MyWorld->OverlapMultiByChannel(Overlaps, OverlapCandidateBounds.GetCenter(), FQuat::Identity, GetCollisionObjectType(), FCollisionShape::MakeBox(OverlapCandidateBounds.GetExtent()), Params, ResponseParam);
+
+		for (const FOverlapResult& Result : Overlaps)
+		{
+			if (UPrimitiveComponent* const HitComp = Result.Component.Get())
+			{
+				FOverlapInfo Candidate(HitComp, Result.ItemIndex);
+				AddUniqueOverlapFast(OverlapCandidates, Candidate);
+			}
+		}
+	}
+	else
+	{
+		INC_DWORD_STAT(STAT_IncrementalOverlapReuses);
+	}
+
+	// Anything overlapping us now is tested as well, it may have moved into the region on its own since the refresh.
+	TInlineOverlapInfoArray TestOverlaps;
+	TestOverlaps.Append(OverlapCandidates);
+
+	for (const FOverlapInfo& CurrentOverlap : OverlappingComponents)
+	{
+		if (!bIgnoreChildren || FPredicateOverlapHasDifferentActor(*MyActor)(CurrentOverlap))
+		{
+			FOverlapInfo ExistingOverlap = CurrentOverlap;
+			AddUniqueOverlapFast(TestOverlaps, ExistingOverlap);
+		}
+	}
+
+	// Past this many narrowphase tests the one full query is cheaper.
+	if (IncrementalOverlapMaxTests > 0 && TestOverlaps.Num() > IncrementalOverlapMaxTests)
+	{
+		INC_DWORD_STAT(STAT_IncrementalOverlapFallbacks);
+		return false;
+	}
+
+	// Per body / instance overlaps (skeletal meshes, instanced meshes) can't be tested per component, let the full query handle them.
+	for (const FOverlapInfo& TestOverlap : TestOverlaps)
+	{
+		if (TestOverlap.GetBodyIndex() != INDEX_NONE)
+			return false;
+	}
+
+	for (const FOverlapInfo& TestOverlap : TestOverlaps)
+	{
+		UPrimitiveComponent* const HitComp = TestOverlap.OverlapInfo.Component.Get();
+
+		if (HitComp && CanComponentsGenerateOverlap(this, HitComp) && !ShouldIgnoreOverlapResult(MyWorld, MyActor, *this, HitComp->GetOwner(), *HitComp, true))
+		{
+			if (HitComp->OverlapComponent(OverlapLocation, OverlapRotation, OverlapShape))
+			{
+				OutOverlaps.Add(TestOverlap);
+			}
+		}
+	}
+
+	return true;
+}
+
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
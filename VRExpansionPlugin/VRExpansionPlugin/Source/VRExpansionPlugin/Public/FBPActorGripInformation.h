@@ -24,6 +24,15 @@
 
 
 
+// Forward Declarations
+
+class AActor;
+class UPrimitiveComponent;
+class UVRGripScriptBase;
+class IVRGripInterface;
+
+
+
 // Enums
 
 UENUM(Blueprintable)
@@ -127,6 +136,51 @@ public:
 
 	};
 
+	// Resolved interface dispatch for this grip, built in NotifyGrip so that the grip tick doesn't have to
+	// reflect the interface every frame. The scripts and settings are still re-read every tick, through a
+	// direct native call when the object doesn't override them in blueprint. Never replicated or RepCopied.
+	struct FGripDispatchCache
+	{
+		bool                 bIsValid          ;
+		bool                 bRootHasInterface ;
+		bool                 bActorHasInterface;
+		bool                 bSimulateOnDrop   ;
+		float                BreakDistance     ;
+		UPrimitiveComponent* CachedRoot        ;   // The root / actor pair the cache was resolved against
+		AActor*              CachedActor       ;
+		IVRGripInterface*    NativeInterface   ;   // Null if the scripts or settings are overridden in blueprint and have to go through reflection
+
+		// Inline so that the per frame iteration and copies of the grip struct do not hit the heap
+		TArray<UVRGripScriptBase*, TInlineAllocator<4>> GripScripts;
+
+		FGripDispatchCache() :
+			bIsValid          (false  ),
+			bRootHasInterface (false  ),
+			bActorHasInterface(false  ),
+			bSimulateOnDrop   (false  ),
+			BreakDistance     (0.0f   ),
+			CachedRoot        (nullptr),
+			CachedActor       (nullptr),
+			NativeInterface   (nullptr)
+		{}
+
+		// Returns the object that should receive interface events, component first then actor
+		FORCEINLINE UObject* GetInterfaceObject() const
+		{
+			return bRootHasInterface ? (UObject*)CachedRoot : (bActorHasInterface ? (UObject*)CachedActor : nullptr);
+		}
+
+		FORCEINLINE bool IsValidFor(const UPrimitiveComponent* Root, const AActor* Actor) const
+		{
+			return bIsValid && CachedRoot == Root && CachedActor == Actor;
+		}
+
+		FORCEINLINE void Invalidate()
+		{
+			bIsValid = false;
+		}
+	};
+
 
 	// Constructors
 
@@ -135,6 +189,19 @@ public:
 		LastLockedRotation            (FRotator::ZeroRotator                                            ),
 		LastWorldTransform            (FTransform::Identity                                             ),
 		bSkipNextConstraintLengthCheck(false                                                            ),
+		BatchedWorldTransform         (FTransform::Identity                                             ),
+		bHasBatchedWorldTransform     (false                                                            ),
+		bBatchedHasValidTransform     (true                                                             ),
+		bBatchedForceDrop             (false                                                            ),
+		bBatchedTickedScripts         (false                                                            ),
+		LastSweptTransform            (FTransform::Identity                                             ),
+		bHasLastSweptTransform        (false                                                            ),
+		LODRelativeTransform          (FTransform::Identity                                             ),
+		LODPreviousRelativeTransform  (FTransform::Identity                                             ),
+		LODSecondaryAttachment        (nullptr                                                          ),
+		LODTimeSinceUpdate            (0.0f                                                             ),
+		LODUpdateInterval             (0.0f                                                             ),
+		bHasLODRelativeTransform      (false                                                            ),
 		GripID                        (INVALID_VRGRIP_ID                                                ),
 		GrippedObject                 (nullptr                                                          ),
 		GripTargetType                (EGripTargetType                 ::ActorGrip                      ),
@@ -256,6 +323,20 @@ public:
 	FTransform      LastWorldTransform            ;   // For delta teleport and any future calculations we want to do
 	bool            bSkipNextConstraintLengthCheck;   // Need to skip one frame of length check post teleport with constrained objects, the constraint may have not been updated yet.
 	FGripValueCache ValueCache                    ;
+	FGripDispatchCache DispatchCache              ;   // Resolved interface pointers and scripts, see UGripMotionControllerComponent::BuildGripDispatchCache
+	FTransform      BatchedWorldTransform         ;   // Default world transform computed for this frame by the UGripTickSubsystem batch
+	bool            bHasBatchedWorldTransform     ;   // Consumed (and cleared) by the next grip tick
+	bool            bBatchedHasValidTransform     ;   // GetGripWorldTransform results when it was evaluated by the batch
+	bool            bBatchedForceDrop             ;
+	bool            bBatchedTickedScripts         ;   // The batch already ran this grips scripts this frame, the grip tick has to use its result instead of running them again
+	FTransform      LastSweptTransform            ;   // Target of the last sweep that reached it unblocked, sweeps within tolerance of it are skipped
+	bool            bHasLastSweptTransform        ;
+	FTransform      LODRelativeTransform          ;   // World transform relative to the controller pivot at the last full update, carries reduced LOD grips between updates
+	const USceneComponent* LODSecondaryAttachment ;   // Secondary attachment at the last full update, a change promotes the grip back to a full update
+	FTransform      LODPreviousRelativeTransform  ;   // LODRelativeTransform of the full update before that, reduced ticks carry on along the motion between the two
+	float           LODTimeSinceUpdate            ;
+	float           LODUpdateInterval             ;   // Time between the last two full updates
+	bool            bHasLODRelativeTransform      ;   // Cleared to force the next tick to be a full update
 
 	UPROPERTY(BlueprintReadOnly, Category = "Settings") uint8                            GripID                        ;   // Hashed unique ID to identify this grip instance
 	UPROPERTY(BlueprintReadOnly, Category = "Settings") UObject*                         GrippedObject                 ;
@@ -6,6 +6,7 @@
 #include "CoreMinimal.h"
 #include "UObject/ObjectMacros.h"
 #include "UObject/Class.h"
+#include "Engine/NetSerialization.h"
 
 // IWVR
 #include "FTransform_NetQuantize.generated.h"
@@ -262,6 +263,54 @@ public:
 
 		return true;
 	}
+
+	// True when vrexp.RepHighPrecisionTransforms is forcing full precision
+	static bool IsHighPrecisionEnabled();
+
+	/*
+	Bit budgeted transform serialization for the profiles below.
+
+	Translation is packed at TranslationScale with at most TranslationMaxBits per component (bounding its range), rotation
+	goes through SerializeQuat_SmallestThree and scale costs a single bit when it is (nearly) unit, otherwise it is packed the same
+	as the default FTransform_NetQuantize.
+	*/
+	template <uint32 TranslationScale, uint32 TranslationMaxBits, uint32 QuatBits>
+	static bool SerializeBounded(FArchive& Ar, FTransform& InTransform)
+	{
+		bool bOutSuccess = true;
+
+		FVector rTranslation = InTransform.GetTranslation();
+		FVector rScale3D     = InTransform.GetScale3D    ();
+		FQuat   rRotation    = InTransform.GetRotation   ();
+
+		if (IsHighPrecisionEnabled())
+		{
+			Ar << rTranslation;
+			Ar << rScale3D    ;
+			Ar << rRotation   ;
+		}
+		else
+		{
+			bOutSuccess &= SerializePackedVector<TranslationScale, TranslationMaxBits>(rTranslation, Ar);
+
+			SerializeQuat_SmallestThree<QuatBits>(Ar, rRotation);
+
+			uint8 bUnitScale = Ar.IsSaving() ? (uint8)rScale3D.Equals(FVector::OneVector, 0.005f) : 0;
+			Ar.SerializeBits(&bUnitScale, 1);
+
+			if (bUnitScale)
+				rScale3D = FVector::OneVector;
+			else
+				bOutSuccess &= SerializePackedVector<100, 30>(rScale3D, Ar);
+		}
+
+		if (Ar.IsLoading())
+		{
+			InTransform.SetComponents(rRotation, rTranslation, rScale3D);
+		}
+
+		return bOutSuccess;
+	}
 };
 
 
@@ -273,3 +322,65 @@ struct TStructOpsTypeTraits< FTransform_NetQuantize > : public TStructOpsTypeTra
 		WithNetSerializer = true
 	};
 };
+
+/**
+* Profile for relative offsets (grip / socket relative transforms). Translation is kept to two decimals within +/- ~104 meters (2^20 / 100 cm),
+* rotation is smallest three at 12 bits per element and unit scale costs one bit.
+*/
+USTRUCT()
+struct FTransform_NetQuantizeRelative : public FTransform_NetQuantize
+{
+	GENERATED_USTRUCT_BODY()
+
+	FORCEINLINE FTransform_NetQuantizeRelative() :
+		FTransform_NetQuantize() {}
+
+	FORCEINLINE FTransform_NetQuantizeRelative(const FTransform& InTransform) :
+		FTransform_NetQuantize(InTransform) {}
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+	{
+		bOutSuccess = SerializeBounded<100, 20, 12>(Ar, *this);
+		return bOutSuccess;
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits< FTransform_NetQuantizeRelative > : public TStructOpsTypeTraitsBase2<FTransform_NetQuantizeRelative>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
+/**
+* Profile for world space transforms (drop transforms). Translation has the same range and precision as FTransform_NetQuantize,
+* rotation is smallest three at 12 bits per element and unit scale costs one bit.
+*/
+USTRUCT()
+struct FTransform_NetQuantizeWorld : public FTransform_NetQuantize
+{
+	GENERATED_USTRUCT_BODY()
+
+	FORCEINLINE FTransform_NetQuantizeWorld() :
+		FTransform_NetQuantize() {}
+
+	FORCEINLINE FTransform_NetQuantizeWorld(const FTransform& InTransform) :
+		FTransform_NetQuantize(InTransform) {}
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+	{
+		bOutSuccess = SerializeBounded<100, 30, 12>(Ar, *this);
+		return bOutSuccess;
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits< FTransform_NetQuantizeWorld > : public TStructOpsTypeTraitsBase2<FTransform_NetQuantizeWorld>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
@@ -14,6 +14,9 @@
 #include "VRGripInterface.h"
 #include "VRGlobalSettings.h"
 #include "GripScripts/VRGripScriptBase.h"
+#include "Misc/VRPoseSnapshotBuffer.h"
+#include "Misc/VRAdaptiveNetUpdateRate.h"
+#include "Misc/VRPoseHistoryBuffer.h"
 #include "XRMotionControllerBase.h" // for GetHandEnumForSourceName()
 #include "GripMotionControllerComponent.generated.h"
 
@@ -26,6 +29,98 @@ class AVRBaseCharacter;
 DECLARE_LOG_CATEGORY_EXTERN(LogVRMotionController, Log, All);
 //For UE4 Profiler ~ Stat Group
 DECLARE_STATS_GROUP(TEXT("TICKGrip"), STATGROUP_TickGrip, STATCAT_Advanced);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Grip Index Rebuilds"), STAT_GripIndexRebuilds, STATGROUP_TickGrip, VREXPANSIONPLUGIN_API);
+
+/**
+* Hashed lookup from GripID / gripped object to a slot in one of the controllers grip arrays.
+* Marked dirty when the array is added to, removed from, replicated or has a grips ID / object changed in place, and lazily
+* rebuilt on the next lookup. The arrays are BlueprintReadOnly so every write goes through C++ and has to call MarkDirty.
+* Found slots are still verified against the array as a safety net, a stale hit costs a rebuild instead of the wrong grip.
+*/
+struct VREXPANSIONPLUGIN_API FGripArrayIndex
+{
+	TMap<uint8, int32>          IDToSlot    ;
+	TMap<const UObject*, int32> ObjectToSlot;
+	int32                       IndexedNum  ;
+	bool                        bIsDirty    ;
+
+	FGripArrayIndex() :
+		IndexedNum(0),
+		bIsDirty(true)
+	{}
+
+	FORCEINLINE void MarkDirty()
+	{
+		bIsDirty = true;
+	}
+
+	// Returns the slot of the first element with this GripID, same as IndexOfByKey(GripID)
+	template<typename ElementType>
+	int32 FindByID(const TArray<ElementType> & Array, uint8 GripID)
+	{
+		if (GripID == INVALID_VRGRIP_ID)
+			return INDEX_NONE;
+
+		if (bIsDirty || IndexedNum != Array.Num())
+			Rebuild(Array);
+
+		const int32 * Slot = IDToSlot.Find(GripID);
+		if (Slot && (!Array.IsValidIndex(*Slot) || Array[*Slot].GripID != GripID))
+		{
+			Rebuild(Array);
+			Slot = IDToSlot.Find(GripID);
+		}
+
+		return Slot ? *Slot : INDEX_NONE;
+	}
+
+	// Returns the slot of the first grip holding this object, same as IndexOfByKey(Object)
+	int32 FindByObject(const TArray<FBPActorGripInformation> & Array, const UObject * Object)
+	{
+		if (!Object)
+			return INDEX_NONE;
+
+		if (bIsDirty || IndexedNum != Array.Num())
+			Rebuild(Array);
+
+		const int32 * Slot = ObjectToSlot.Find(Object);
+		if (Slot && (!Array.IsValidIndex(*Slot) || Array[*Slot].GrippedObject != Object))
+		{
+			Rebuild(Array);
+			Slot = ObjectToSlot.Find(Object);
+		}
+
+		return Slot ? *Slot : INDEX_NONE;
+	}
+
+private:
+
+	static FORCEINLINE const UObject * GetIndexedObject(const FBPActorGripInformation & Grip) { return Grip.GrippedObject; }
+	static FORCEINLINE const UObject * GetIndexedObject(const FBPActorPhysicsHandleInformation & Handle) { return Handle.HandledObject; }
+
+	template<typename ElementType>
+	void Rebuild(const TArray<ElementType> & Array)
+	{
+		INC_DWORD_STAT(STAT_GripIndexRebuilds);
+
+		IDToSlot.Reset();
+		ObjectToSlot.Reset();
+
+		// Keep the first match for duplicates so results line up with the linear searches this replaces
+		for (int32 i = 0; i < Array.Num(); ++i)
+		{
+			if (Array[i].GripID != INVALID_VRGRIP_ID && !IDToSlot.Contains(Array[i].GripID))
+				IDToSlot.Add(Array[i].GripID, i);
+
+			const UObject * Object = GetIndexedObject(Array[i]);
+			if (Object && !ObjectToSlot.Contains(Object))
+				ObjectToSlot.Add(Object, i);
+		}
+
+		IndexedNum = Array.Num();
+		bIsDirty = false;
+	}
+};
 
 /** Delegate for notification when the controller grips a new object. */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FVRGripControllerOnTrackingEventSignature);
@@ -65,6 +160,31 @@ public:
 
 public:
 
+	/**
+	* A component hierarchy below a late update root flattened into a list, it is revalidated each frame instead of walked again.
+	* Any attach or detach below the root changes either a cached child count or a cached attach parent, which triggers a rebuild.
+	*/
+	struct FCachedLateUpdateHierarchy
+	{
+		struct FCachedComponent
+		{
+			TWeakObjectPtr<USceneComponent> Component;
+			const USceneComponent * AttachParent; // Only compared against, never dereferenced
+			int32 NumAttachChildren;
+		};
+
+		TArray<FCachedComponent> Components; // Root first
+		TArray<USceneComponent*> SkipComponents; // Direct children of the root that were left out of the list
+		uint32 LastUsedSetup;
+
+		FCachedLateUpdateHierarchy() :
+			LastUsedSetup(0)
+		{}
+
+		bool IsUpToDate(const TArray<USceneComponent*> * SkipComponentList) const;
+		void Rebuild(USceneComponent * Root, const TArray<USceneComponent*> * SkipComponentList);
+	};
+
 	/** A utility method that calls CacheSceneInfo on ParentComponent and all of its descendants */
 	void GatherLateUpdatePrimitives(USceneComponent* ParentComponent, TArray<USceneComponent*> *SkipComponentList = nullptr);
 	void ProcessGripArrayLateUpdatePrimitives(UGripMotionControllerComponent* MotionController, TArray<FBPActorGripInformation> & GripArray, TArray<USceneComponent*> &SkipComponentList);
@@ -82,6 +202,12 @@ public:
 	int32 LateUpdateGameWriteIndex;
 	int32 LateUpdateRenderReadIndex;
 
+	/** Game thread only, keyed by the root component, entries not used by a Setup call are dropped at the end of it */
+	TMap<const USceneComponent*, FCachedLateUpdateHierarchy> CachedHierarchies;
+	/** Reused by Setup every frame */
+	TArray<USceneComponent*> ComponentsThatSkipLateUpdate;
+	uint32 SetupCounter;
+
 };
 
 /**
@@ -241,6 +367,21 @@ public:
 	UPROPERTY(BlueprintReadOnly, Replicated, Category = "GripMotionController", ReplicatedUsing = OnRep_LocallyGrippedObjects)
 	TArray<FBPActorGripInformation> LocallyGrippedObjects;
 
+	// Slot lookups for the grip arrays, if you add or remove grips from the arrays directly call MarkGripIndicesDirty afterwards
+	FGripArrayIndex GrippedObjectsIndex;
+	FGripArrayIndex LocallyGrippedObjectsIndex;
+
+	inline void MarkGripIndicesDirty()
+	{
+		GrippedObjectsIndex.MarkDirty();
+		LocallyGrippedObjectsIndex.MarkDirty();
+		PhysicsGripsIndex.MarkDirty();
+	}
+
+	// Searches GrippedObjects and then LocallyGrippedObjects through their indices, returns nullptr if not found
+	FBPActorGripInformation * FindGripByID(uint8 GripID);
+	FBPActorGripInformation * FindGripByObject(const UObject * ObjectToFind);
+
 	// Locally Gripped Array functions
 
 	// Notify a client that their local grip was bad
@@ -262,12 +403,12 @@ public:
 	UFUNCTION(Reliable, Server, WithValidation)
 		void Server_NotifySecondaryAttachmentChanged_Retain(
 			uint8 GripID,
-			const FBPSecondaryGripInfo& SecondaryGripInfo, const FTransform_NetQuantize & NewRelativeTransform);
+			const FBPSecondaryGripInfo& SecondaryGripInfo, const FTransform_NetQuantizeRelative & NewRelativeTransform);
 
 	// Notify change on relative position editing as well, make RPCS callable in blueprint
 	// Notify the server that we locally gripped something
 	UFUNCTION(Reliable, Server, WithValidation)
-	void Server_NotifyLocalGripRemoved(uint8 GripID, const FTransform_NetQuantize &TransformAtDrop, FVector_NetQuantize100 AngularVelocity, FVector_NetQuantize100 LinearVelocity);
+	void Server_NotifyLocalGripRemoved(uint8 GripID, const FTransform_NetQuantizeWorld &TransformAtDrop, FVector_NetQuantize100 AngularVelocity, FVector_NetQuantize100 LinearVelocity);
 	
 
 	// Enable this to send the TickGrip event every tick even for non custom grip types - has a slight performance hit
@@ -287,8 +428,12 @@ public:
 		{
 			DestroyPhysicsHandle(/*PhysicsGrips[HandleIndex].SceneIndex,*/ &PhysicsGrips[HandleIndex].HandleData, &PhysicsGrips[HandleIndex].KinActorData);
 			PhysicsGrips.RemoveAt(HandleIndex);
+			PhysicsGripsIndex.MarkDirty();
 		}
 
+		// Swept state was for the old collision type
+		GripInfo.bHasLastSweptTransform = false;
+
 		// Grip Type or replication was changed
 		NotifyGrip(GripInfo, true);
 	}
@@ -296,6 +441,9 @@ public:
 	// Handles variable state changes and specific actions on a grip replication
 	inline bool HandleGripReplication(FBPActorGripInformation & Grip)
 	{
+		// Something about the grip changed, run it at full rate next tick
+		Grip.bHasLODRelativeTransform = false;
+
 		if (Grip.ValueCache.bWasInitiallyRepped && Grip.GripID != Grip.ValueCache.CachedGripID)
 		{
 			// There appears to be a bug with TArray replication where if you replace an index with another value of that
@@ -312,6 +460,8 @@ public:
 
 			// null ptr so this doesn't block grip operations
 			Grip.GrippedObject = nullptr;
+			GrippedObjectsIndex.MarkDirty();
+			LocallyGrippedObjectsIndex.MarkDirty();
 
 			// Set to paused so iteration skips it
 			Grip.bIsPaused = true;
@@ -450,6 +600,9 @@ public:
 		// Check for removed gripped actors
 		// This might actually be better left as an RPC multicast
 
+		// Grips can be replaced in place by the array replication
+		GrippedObjectsIndex.MarkDirty();
+
 		for (int i = GrippedObjects.Num() - 1; i >= 0; --i)
 		{
 			HandleGripReplication(GrippedObjects[i]);
@@ -459,6 +612,8 @@ public:
 	UFUNCTION()
 	virtual void OnRep_LocallyGrippedObjects()
 	{
+		LocallyGrippedObjectsIndex.MarkDirty();
+
 		for (int i = LocallyGrippedObjects.Num() - 1; i >= 0; --i)
 		{
 			HandleGripReplication(LocallyGrippedObjects[i]);
@@ -480,6 +635,9 @@ public:
 	bool bLerpingPosition;
 	bool bReppedOnce;
 
+	// Remote smoothing when the pose snapshot buffer is enabled in the global settings
+	FVRPoseSnapshotBuffer ReplicatedPoseBuffer;
+
 	UFUNCTION()
 	virtual void OnRep_ReplicatedControllerTransform()
 	{
@@ -487,7 +645,12 @@ public:
 
 		if (bSmoothReplicatedMotion)
 		{
-			if (bReppedOnce)
+			if (ReplicatedPoseBuffer.AddSnapshot(GetWorld(), ReplicatedControllerTransform))
+			{
+				bLerpingPosition = false;
+				bReppedOnce = true;
+			}
+			else if (bReppedOnce)
 			{
 				bLerpingPosition = true;
 				ControllerNetUpdateCount = 0.0f;
@@ -501,7 +664,10 @@ public:
 			}
 		}
 		else
+		{
+			ReplicatedPoseBuffer.Reset();
 			SetRelativeLocationAndRotation(ReplicatedControllerTransform.Position, ReplicatedControllerTransform.Rotation);
+		}
 	}
 
 	// Rate to update the position to the server, 100htz is default (same as replication rate, should also hit every tick).
@@ -511,6 +677,19 @@ public:
 	// Used in Tick() to accumulate before sending updates, didn't want to use a timer in this case, also used for remotes to lerp position
 	float ControllerNetUpdateCount;
 
+	// Picks the send rate each tick when bUseAdaptiveNetUpdateRate is on in the global settings
+	FVRAdaptiveNetUpdateRate AdaptiveNetUpdateRate;
+
+	// Server side world poses of a remote players controller, only recorded when bValidateClientAuthMovement is on in the global settings
+	FVRPoseHistoryBuffer ServerPoseHistory;
+
+	// Rate the controller is currently sending its transform at, ControllerNetUpdateRate unless the adaptive rate is lowering it
+	UFUNCTION(BlueprintPure, Category = "GripMotionController|Networking")
+	float GetEffectiveNetUpdateRate() const
+	{
+		return AdaptiveNetUpdateRate.EffectiveRate > 0.0f ? AdaptiveNetUpdateRate.EffectiveRate : ControllerNetUpdateRate;
+	}
+
 	// Whether to smooth (lerp) between ticks for the replicated motion, DOES NOTHING if update rate is larger than FPS!
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Replicated, Category = "GripMotionController|Networking")
 		bool bSmoothReplicatedMotion;
@@ -581,7 +760,7 @@ public:
 
 	// Notify the server about a new drop and socket
 	UFUNCTION(Reliable, Server, WithValidation, Category = "GripMotionController")
-		void Server_NotifyDropAndSocketGrip(uint8 GripID, USceneComponent * SocketingParent, FName OptionalSocketName, const FTransform_NetQuantize & RelativeTransformToParent, bool bWeldBodies = true);
+		void Server_NotifyDropAndSocketGrip(uint8 GripID, USceneComponent * SocketingParent, FName OptionalSocketName, const FTransform_NetQuantizeRelative & RelativeTransformToParent, bool bWeldBodies = true);
 
 	UFUNCTION(Reliable, NetMulticast)
 		void NotifyDropAndSocket(const FBPActorGripInformation &NewDrop);
@@ -837,11 +1016,45 @@ public:
 	// Running the gripping logic in its own function as the main tick was getting bloated
 	void TickGrip(float DeltaTime);
 
+	// Set while this controller is registered with the UGripTickSubsystem (vr.BatchGripTransforms), it calls TickGrip for us
+	bool bUsesBatchedGripTick;
+
+	// Grip LOD state, refreshed at the start of every TickGrip from the GripLOD settings in UVRGlobalSettings
+	bool bGripLODActive; // Enabled and this controller belongs to another player
+	bool bGripLODOutOfViewRange; // No player viewpoint is within GripLODDistance of this controller
+	void UpdateGripLODState();
+
+	// Carries a reduced LOD grip along with the hand between its full updates, returns false if the grip needs a full update this tick
+	bool TickReducedLODGrip(FBPActorGripInformation & Grip, UPrimitiveComponent * root, const FTransform & ParentTransform, float DeltaTime);
+
+	// Returns if the grip is in a state where the UGripTickSubsystem can compute its world transform ahead of the grip tick
+	bool IsBatchableGrip(const FBPActorGripInformation & Grip);
+
+	// Returns if the grips world transform is only the default Relative * Addition * Parent, these can be batched
+	bool IsDefaultGripWorldTransform(const FBPActorGripInformation & Grip);
+
+	// Returns if every script that GetGripWorldTransform would run for this grip is thread safe (vr.ParallelGripTransforms)
+	bool CanEvaluateGripWorldTransformAsync(const FBPActorGripInformation & Grip);
+
+	// Resolves the interface for a grip once so that the tick doesn't have to reflect it every frame
+	void BuildGripDispatchCache(FBPActorGripInformation & Grip, UPrimitiveComponent * root, AActor * actor);
+
+	// Re-reads the grip scripts, break distance and simulate on drop into the cache, returns true if the scripts changed
+	bool RefreshGripDispatchCache(FBPActorGripInformation & Grip);
+
+	// Flags the cached dispatch information for grips on this object as stale, it will be rebuilt on the next grip tick
+	// Scripts and settings are refreshed every tick on their own, this is only needed if the interface object itself changed
+	UFUNCTION(BlueprintCallable, Category = "GripMotionController")
+		void InvalidateGripDispatchCache(UObject * GrippedObjectToRefresh);
+
+	// Reused by RefreshGripDispatchCache so that gathering the scripts doesn't allocate every tick
+	TArray<UVRGripScriptBase*> GripScriptsScratch;
+
 	// Splitting logic into separate function
 	void HandleGripArray(TArray<FBPActorGripInformation> &GrippedObjectsArray, const FTransform & ParentTransform, float DeltaTime, bool bReplicatedArray = false);
 
 	// Gets the world transform of a grip, modified by secondary grips, returns if it has a valid transform, if not then this tick will be skipped for the object
-	bool GetGripWorldTransform(TArray<UVRGripScriptBase*>& GripScripts, float DeltaTime,FTransform & WorldTransform, const FTransform &ParentTransform, FBPActorGripInformation &Grip, AActor * actor, UPrimitiveComponent * root, bool bRootHasInterface, bool bActorHasInterface, bool bIsForTeleport, bool &bForceADrop);
+	bool GetGripWorldTransform(TArrayView<UVRGripScriptBase*> GripScripts, float DeltaTime,FTransform & WorldTransform, const FTransform &ParentTransform, FBPActorGripInformation &Grip, AActor * actor, UPrimitiveComponent * root, bool bRootHasInterface, bool bActorHasInterface, bool bIsForTeleport, bool &bForceADrop);
 
 	// Calculate component to world without the protected tag, doesn't set it, just returns it
 	inline FTransform CalcControllerComponentToWorld(FRotator Orientation, FVector Position)
@@ -939,6 +1152,11 @@ public:
 	bool bUseWithoutTracking;
 
 	bool CheckComponentWithSweep(UPrimitiveComponent * ComponentToCheck, FVector Move, FRotator newOrientation, bool bSkipSimulatingComponents/*, bool & bHadBlockingHitOut*/);
+
+	// Returns true if the last unblocked sweep for this grip still holds, neither the target nor the root have moved further than
+	// vr.GripSweepSkipDistance / vr.GripSweepSkipAngle from it. The previous collision state is reused instead of sweeping again.
+	// Only used where the sweep is the move or a collision query, SweepWithPhysics sweeps for the events and never skips.
+	bool CanSkipGripSweep(const FBPActorGripInformation & Grip, const FTransform & TargetTransform, const UPrimitiveComponent * root) const;
 	
 	// For physics handle operations
 	bool SetUpPhysicsHandle(const FBPActorGripInformation &NewGrip);
@@ -948,6 +1166,7 @@ public:
 	bool GetPhysicsJointLength(const FBPActorGripInformation &GrippedActor, UPrimitiveComponent * rootComp, FVector & LocOut);
 
 	TArray<FBPActorPhysicsHandleInformation> PhysicsGrips;
+	FGripArrayIndex PhysicsGripsIndex;
 	FBPActorPhysicsHandleInformation * GetPhysicsGrip(const FBPActorGripInformation & GripInfo);
 	bool GetPhysicsGripIndex(const FBPActorGripInformation & GripInfo, int & index);
 	FBPActorPhysicsHandleInformation * CreatePhysicsGrip(const FBPActorGripInformation & GripInfo);
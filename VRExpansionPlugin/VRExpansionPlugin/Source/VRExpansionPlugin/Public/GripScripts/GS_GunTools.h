@@ -196,6 +196,7 @@ public:
 		void ResetRecoil();
 
 	virtual bool GetWorldTransform_Implementation(UGripMotionControllerComponent* GrippingController, float DeltaTime, FTransform& WorldTransform, const FTransform& ParentTransform, FBPActorGripInformation& Grip, AActor* actor, UPrimitiveComponent* root, bool bRootHasInterface, bool bActorHasInterface, bool bIsForTeleport) override;
+	virtual bool IsThreadSafe_GetWorldTransform(const FBPActorGripInformation& Grip) override;
 	
 	inline void GunTools_ApplySmoothingAndLerp(FBPActorGripInformation& Grip, FVector& frontLoc, FVector& frontLocOrig, float DeltaTime, bool bSkipHighQualitySimulations)
 	{
@@ -48,6 +48,10 @@ public:
 	virtual bool GetWorldTransform_Implementation(UGripMotionControllerComponent * OwningController, float DeltaTime, FTransform & WorldTransform, const FTransform &ParentTransform, FBPActorGripInformation &Grip, AActor * actor, UPrimitiveComponent * root, bool bRootHasInterface, bool bActorHasInterface, bool bIsForTeleport) override;
 	virtual void OnGrip_Implementation(UGripMotionControllerComponent * GrippingController, const FBPActorGripInformation & GripInformation) override;
 	virtual void OnGripRelease_Implementation(UGripMotionControllerComponent * ReleasingController, const FBPActorGripInformation & GripInformation, bool bWasSocketed) override;
+	virtual bool IsThreadSafe_GetWorldTransform(const FBPActorGripInformation& Grip) override;
+
+	// Broadcasts OnLerpToHandFinished, deferred to the game thread if the transform was evaluated in parallel
+	void BroadcastLerpFinished();
 
 	// Declares
 	float CurrentLerpTime;
@@ -178,6 +178,14 @@ public:
 		return GetWorldTransform_Implementation(OwningController, DeltaTime, WorldTransform, ParentTransform, Grip, actor, root, bRootHasInterface, bActorHasInterface, bIsForTeleport);
 	}
 
+	// Returns if GetWorldTransform can run off of the game thread for this grip (vr.ParallelGripTransforms)
+	// Only return true if the native path touches nothing but the grip, this script and read only state, no UObject events, delegates or engine queries
+	// Blueprint scripts are never thread safe
+	virtual bool IsThreadSafe_GetWorldTransform(const FBPActorGripInformation& Grip)
+	{
+		return false;
+	}
+
 	// Declares 
 
 	// Is currently active helper variable, returned from IsScriptActive()
@@ -142,6 +142,46 @@ struct TStructOpsTypeTraits<FRepMovementVR> : public TStructOpsTypeTraitsBase2<F
 	};
 };
 
+// A single client auth thrown actors movement inside of a FVRClientAuthThrowBatch
+USTRUCT()
+struct VREXPANSIONPLUGIN_API FVRClientAuthThrowEntry
+{
+	GENERATED_BODY()
+
+public:
+
+	UPROPERTY()
+		AActor * ThrownActor;
+
+	UPROPERTY()
+		FRepMovementVR Movement;
+
+	FVRClientAuthThrowEntry() :
+		ThrownActor(nullptr)
+	{}
+};
+
+// All of a connections client auth thrown actors that moved since the last send, sent in one RPC through the owning AVRBaseCharacter
+USTRUCT()
+struct VREXPANSIONPLUGIN_API FVRClientAuthThrowBatch
+{
+	GENERATED_BODY()
+
+public:
+
+	// Only the actors that moved this update are in here, an actor that came to rest simply stops being added
+	UPROPERTY()
+		TArray<FVRClientAuthThrowEntry> Entries;
+
+	// Senders world time when the batch was sent, shared by every entry
+	UPROPERTY()
+		float TimeStamp;
+
+	FVRClientAuthThrowBatch() :
+		TimeStamp(0.0f)
+	{}
+};
+
 USTRUCT(BlueprintType)
 struct VREXPANSIONPLUGIN_API FVRClientAuthReplicationData
 {
@@ -152,11 +192,14 @@ public:
 	// Constructor
 
 	FVRClientAuthReplicationData() :
-		bIsCurrentlyClientAuth(false               ),
-		LastActorTransform    (FTransform::Identity),
-		TimeAtInitialThrow    (0.0f                ),
-		bUseClientAuthThrowing(false               ),
-		UpdateRate            (30                  )
+		bIsCurrentlyClientAuth    (false               ),
+		LastActorTransform        (FTransform::Identity),
+		TimeAtInitialThrow        (0.0f                ),
+		bServerHasAcceptedMovement(false               ),
+		ServerLastAcceptedLocation(FVector::ZeroVector ),
+		ServerLastAcceptedTime    (0.0f                ),
+		bUseClientAuthThrowing    (false               ),
+		UpdateRate                (30                  )
 	{ }
 
 
@@ -167,6 +210,11 @@ public:
 	FTimerHandle ResetReplicationHandle;
 	float        TimeAtInitialThrow    ;
 
+	// Server side, last client auth movement that passed validation for the current throw
+	bool         bServerHasAcceptedMovement;
+	FVector      ServerLastAcceptedLocation;
+	float        ServerLastAcceptedTime    ;
+
 	// If True and we are using a client auth grip type then we will replicate our throws on release.
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRReplication")
 		bool bUseClientAuthThrowing;
@@ -195,114 +243,21 @@ public:
 
 		static bool IsInitialized();
 
-		virtual void OnTick(float DeltaSeconds, TMap<TWeakObjectPtr<UPrimitiveComponent>, FReplicatedPhysicsTarget>& ComponentsToTargets) override
-		{
-			// Skip all of the custom logic if we aren't the server.
-			if (const UWorld* World = GetOwningWorld())
-			{
-				if (World->GetNetMode() == ENetMode::NM_Client)
-				{
-					return FPhysicsReplication::OnTick(DeltaSeconds, ComponentsToTargets);
-				}
-			}
-
-			const FRigidBodyErrorCorrection& PhysicErrorCorrection = UPhysicsSettings::Get()->PhysicErrorCorrection;
+		// Server side processing of client auth targets, latency compensated off of the owners ping and budgeted per tick
+		// by the PhysicsReplication global settings, with the targets taken round robin when over budget.
+		virtual void OnTick(float DeltaSeconds, TMap<TWeakObjectPtr<UPrimitiveComponent>, FReplicatedPhysicsTarget>& ComponentsToTargets) override;
 
-			// Get the ping between this PC & the server.
-			const float LocalPing = 0.0f;   //GetLocalPing();
+	private:
 
-			float CurrentTimeSeconds = 0.0f;
+		// Returns true if the target is finished and should be removed, DeltaSeconds is the time since it was last processed
+		bool ProcessTarget(float DeltaSeconds, UPrimitiveComponent * PrimComp, FReplicatedPhysicsTarget & PhysicsTarget, const FRigidBodyErrorCorrection & PhysicErrorCorrection, bool bSkipSkeletalSync);
 
-			if (UWorld* OwningWorld = GetOwningWorld())
-			{
-				CurrentTimeSeconds = OwningWorld->GetTimeSeconds();
-			}
+		// Owners round trip ping in seconds, 0 if it isn't owned by a player
+		static float GetOwnerPingSeconds(const AActor * OwningActor);
 
-			for (auto Itr = ComponentsToTargets.CreateIterator(); Itr; ++Itr)
-			{
-				/*
-				Its been more than half a second since the last update, lets cease using the target as a failsafe.
-				Clients will never update with that much latency, and if they somehow are, then they are dropping so many.
-				packets that it will be useless to use their data anyway.
-				*/
-				if ((CurrentTimeSeconds - Itr.Value().ArrivedTimeSeconds) > 0.5f)
-				{
-					OnTargetRestored(Itr.Key().Get(), Itr.Value());
-
-					Itr.RemoveCurrent();
-				}
-				else if (UPrimitiveComponent* PrimComp = Itr.Key().Get())
-				{
-					bool bRemoveItr = false;
-
-					if (FBodyInstance* BI = PrimComp->GetBodyInstance(Itr.Value().BoneName))
-					{
-						FReplicatedPhysicsTarget& PhysicsTarget = Itr.Value();
-
-						FRigidBodyState& UpdatedState = PhysicsTarget.TargetState;
-
-						bool bUpdated = false;
-
-						if (AActor* OwningActor = PrimComp->GetOwner())
-						{
-							// Deleted everything here, we will always be the server, I already filtered out clients to default logic.
-							{
-								/*const*/ float OwnerPing = 0.0f;   // GetOwnerPing(OwningActor, PhysicsTarget);
-						
-								/*if (UPlayer* OwningPlayer = OwningActor->GetNetOwningPlayer())
-								{
-									if (APlayerController* PlayerController = OwningPlayer->GetPlayerController(nullptr))
-									{
-										if (APlayerState* PlayerState = PlayerController->PlayerState)
-										{
-											OwnerPing = PlayerState->ExactPing;
-										}
-									}
-								}*/
-
-								/*
-								Get the total ping - this approximates the time since the update was
-								actually generated on the machine that is doing the authoritative sim.
-								// NOTE: We divide by 2 to approximate 1-way ping from 2-way ping.
-								*/
-								const float PingSecondsOneWay = 0.0f;   // (LocalPing + OwnerPing) * 0.5f * 0.001f;
-
-
-								if (UpdatedState.Flags & ERigidBodyFlags::NeedsUpdate)
-								{
-									const bool bRestoredState = ApplyRigidBodyState(DeltaSeconds, BI, PhysicsTarget, PhysicErrorCorrection, PingSecondsOneWay);
-
-									// Need to update the component to match new position.
-									static const auto CVarSkipSkeletalRepOptimization = IConsoleManager::Get().FindConsoleVariable(TEXT("p.SkipSkeletalRepOptimization"));
-
-									//Simulated skeletal mesh does its own polling of physics results so we don't need to call this as it'll happen at the end of the physics sim.
-									if (/*PhysicsReplicationCVars::SkipSkeletalRepOptimization*/CVarSkipSkeletalRepOptimization->GetInt() == 0 || Cast<USkeletalMeshComponent>(PrimComp) == nullptr)	
-									{
-										PrimComp->SyncComponentToRBPhysics();
-									}
-
-									// Added a sleeping check from the input state as well, we always want to cease activity on sleep.
-									if (bRestoredState || ((UpdatedState.Flags & ERigidBodyFlags::Sleeping) != 0))
-									{
-										bRemoveItr = true;
-									}
-								}
-							}
-						}
-					}
-
-					if (bRemoveItr)
-					{
-						OnTargetRestored(Itr.Key().Get(), Itr.Value());
-
-						Itr.RemoveCurrent();
-					}
-				}
-			}
-
-			//GEngine->AddOnScreenDebugMessage(-1, 5.f, FColor::Red, TEXT("Phys Rep Tick!"));
-			//FPhysicsReplication::OnTick(DeltaSeconds, ComponentsToTargets);
-		}
+		TArray<TWeakObjectPtr<UPrimitiveComponent>> TargetKeys; // Reused each tick to avoid allocating
+		int32 RoundRobinIndex; // First target to process next tick when over budget
+		TMap<TWeakObjectPtr<UPrimitiveComponent>, float> LastProcessedTimes; // World time each target was last processed at
 	};
 
 	class IPhysicsReplicationFactoryVR : public IPhysicsReplicationFactory
@@ -133,6 +133,14 @@ public:
 		void CeaseReplicationBlocking();
 
 	UFUNCTION()	bool PollReplicationEvent();
+
+	// Puts us to sleep once free and at rest when bUseAutoNetDormancy is on
+	UFUNCTION()
+		bool PollNetDormancy();
+
+	float LastInteractionTime; // Server side, when we were last gripped or released
+
+	virtual float GetNetPriority(const FVector& ViewPos, const FVector& ViewDir, AActor* Viewer, AActor* ViewTarget, UActorChannel* InChannel, float Time, bool bLowBandwidth) override;
 	
 	// Notify the server that we locally gripped something.
 	UFUNCTION(UnReliable, Server, WithValidation, Category = "Networking")
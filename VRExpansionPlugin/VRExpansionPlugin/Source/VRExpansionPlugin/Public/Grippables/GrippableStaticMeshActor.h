@@ -78,6 +78,14 @@ public:
 	UFUNCTION()
 	bool PollReplicationEvent();
 
+	// Puts us to sleep once free and at rest when bUseAutoNetDormancy is on
+	UFUNCTION()
+		bool PollNetDormancy();
+
+	float LastInteractionTime; // Server side, when we were last gripped or released
+
+	virtual float GetNetPriority(const FVector& ViewPos, const FVector& ViewDir, AActor* Viewer, AActor* ViewTarget, UActorChannel* InChannel, float Time, bool bLowBandwidth) override;
+
 	UFUNCTION(Category = "Networking")
 		void CeaseReplicationBlocking();
 
@@ -224,6 +224,7 @@ public:
 
 	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRGripInterface")
 		EGripMovementReplicationSettings MovementReplicationSetting;
@@ -245,6 +246,12 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = "VRGripInterface")
 		bool bIsHeld; // Set on grip notify, not net serializing
 
+	float LastInteractionTime; // Server side, when we were last gripped or released
+
+	// Puts our owner to sleep once every interactible on it is free and at rest when bUseAutoNetDormancy is on
+	UFUNCTION()
+		bool PollNetDormancy();
+
 	UPROPERTY(BlueprintReadOnly, Category = "VRGripInterface")
 		FBPGripPair HoldingGrip; // Set on grip notify, not net serializing
 	bool bOriginalReplicatesMovement;
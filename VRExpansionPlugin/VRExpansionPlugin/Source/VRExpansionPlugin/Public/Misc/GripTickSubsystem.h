@@ -0,0 +1,141 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "Engine/EngineBaseTypes.h"
+#include "GripTickSubsystem.generated.h"
+
+class UGripMotionControllerComponent;
+struct FBPActorGripInformation;
+struct FGripTickBatch;
+
+// Enabled with vr.BatchGripTransforms, controllers register with this on BeginPlay
+// Engine subsystem as world subsystems don't exist in this engine version, each world gets its own batch instead
+
+/**
+* Tick function for a worlds grip batch, it is set to be dependent on the tick of every registered controller
+* so that all tracking / replicated transforms are updated before the default grip transforms are computed.
+*/
+USTRUCT()
+struct VREXPANSIONPLUGIN_API FGripBatchTickFunction : public FTickFunction
+{
+	GENERATED_USTRUCT_BODY()
+
+	FGripTickBatch * Batch;
+
+	FGripBatchTickFunction() :
+		Batch(nullptr)
+	{}
+
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FGripBatchTickFunction> : public TStructOpsTypeTraitsBase2<FGripBatchTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+/**
+* A grip whose scripts are all thread safe, GetGripWorldTransform is run for it in a ParallelFor and
+* the game thread only applies the results (vr.ParallelGripTransforms).
+*/
+struct FGripAsyncTransformEvaluation
+{
+	UGripMotionControllerComponent * Controller;
+	FBPActorGripInformation * Grip;
+	int32 ParentIndex;
+	FTransform WorldTransform;
+	bool bHasValidTransform;
+	bool bForceDrop;
+
+	FGripAsyncTransformEvaluation(UGripMotionControllerComponent * InController, FBPActorGripInformation * InGrip, int32 InParentIndex) :
+		Controller(InController),
+		Grip(InGrip),
+		ParentIndex(InParentIndex),
+		WorldTransform(FTransform::Identity),
+		bHasValidTransform(false),
+		bForceDrop(false)
+	{}
+};
+
+/**
+* All of the grips in a world that only use the default grip transform, stored as structure of arrays so that the
+* transform pass runs over contiguous memory instead of hopping between controllers and grip structs.
+* Buffers are reset (not freed) every frame.
+*/
+struct VREXPANSIONPLUGIN_API FGripTickBatch
+{
+	FGripBatchTickFunction TickFunction;
+	TArray<TWeakObjectPtr<UGripMotionControllerComponent>> Controllers;
+	bool bIsTicking;
+
+	// Per controller, in the order they were gathered this frame
+	TArray<TWeakObjectPtr<UGripMotionControllerComponent>> GatheredControllers;
+	TArray<FTransform> ParentTransforms;
+	TArray<float> DeltaTimes; // Includes the owners time dilation, same as the controllers own tick would get
+
+	// Per grip
+	TArray<int32> ParentIndices;
+	TArray<FTransform> RelativeTransforms;
+	TArray<FTransform> AdditionTransforms;
+	TArray<FTransform> TargetTransforms;
+	TArray<FBPActorGripInformation*> Grips; // Only valid between the gather and the hand back of a single frame
+
+	// Grips evaluated in parallel through their thread safe scripts, same lifetime as Grips
+	TArray<FGripAsyncTransformEvaluation> AsyncGrips;
+	TSet<UObject*> AsyncGrippedObjects; // Multiple grips on one object share its scripts, only one of them can go wide
+
+	FGripTickBatch() :
+		bIsTicking(false)
+	{}
+
+	void Tick(float DeltaTime);
+
+private:
+
+	void GatherGrips(UGripMotionControllerComponent * Controller, TArray<FBPActorGripInformation> & GripArray, int32 ParentIndex, bool bAllowAsync);
+	void InvalidateMovedGrips(TArray<FBPActorGripInformation> & GripArray, const FTransform & OldParentTransform, const FTransform & NewParentTransform);
+	void ComputeTargetTransforms();
+	void EvaluateAsyncTransforms();
+};
+
+UCLASS()
+class VREXPANSIONPLUGIN_API UGripTickSubsystem : public UEngineSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UGripTickSubsystem() :
+		Super()
+	{
+
+	}
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// Adds a controller to its worlds grip batch, the controller stops calling TickGrip itself while it is registered
+	bool RegisterController(UGripMotionControllerComponent * Controller);
+
+	// Removes a controller from its worlds grip batch, the batch is torn down once it is empty
+	void UnregisterController(UGripMotionControllerComponent * Controller);
+
+	// Returns the number of grips that were batched in the given world last frame
+	UFUNCTION(BlueprintPure, Category = "GripTickSubsystem")
+		int32 GetNumBatchedGrips(UObject * WorldContextObject);
+
+private:
+
+	void OnWorldCleanup(UWorld * World, bool bSessionEnded, bool bCleanupResources);
+	void DestroyBatch(UWorld * World);
+
+	TMap<TWeakObjectPtr<UWorld>, TUniquePtr<FGripTickBatch>> WorldBatches;
+	FDelegateHandle OnWorldCleanupHandle;
+};
@@ -0,0 +1,36 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+struct FBPVRComponentPosRep;
+
+/**
+* Picks the send rate of a locally tracked component (camera / motion controller) from how fast it is moving.
+* Still components drop toward AdaptiveNetUpdateMinRate, fast ones rise to the components own configured rate, and the
+* result is capped so that the characters three tracked poses stay within a share of the connections bandwidth.
+* Settings live in UVRGlobalSettings, with bUseAdaptiveNetUpdateRate off the configured rate is passed straight through.
+*/
+struct VREXPANSIONPLUGIN_API FVRAdaptiveNetUpdateRate
+{
+	FVRAdaptiveNetUpdateRate() :
+		EffectiveRate(0.0f),
+		LastPosition(FVector::ZeroVector),
+		LastRotation(FQuat::Identity),
+		bHasLastPose(false)
+	{}
+
+	// Call every tick with the components current relative pose, PoseRep is the components replicated pose, only its quantization
+	// levels are used to size a send for the bandwidth cap, returns the rate to send at this tick
+	float Update(const AActor * Owner, float DeltaTime, const FBPVRComponentPosRep & PoseRep, const FVector & Position, const FRotator & Rotation, float MaxRate);
+
+	float EffectiveRate; // Last rate returned from Update
+
+private:
+
+	FVector LastPosition;
+	FQuat   LastRotation;
+	bool    bHasLastPose;
+};
@@ -0,0 +1,39 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+
+/**
+* Automatic net dormancy for grippables and interactibles, controlled by bUseAutoNetDormancy in UVRGlobalSettings.
+* Objects are woken (and have their interaction time stamped) when gripped or released, and are put back to
+* DORM_DormantAll once they are no longer held and have been at rest for AutoDormancyRestTime. Dormant objects are
+* still polled and are woken again if their physics body wakes up on the server. Recently touched objects also get
+* their net priority boosted. Everything here is a no-op off of the server.
+*/
+struct VREXPANSIONPLUGIN_API FVRNetDormancyUtils
+{
+	// Wakes the actor if it was dormant and stamps LastInteractionTime, call on grip / release
+	static void WakeActor(AActor * Actor, float & LastInteractionTime);
+
+	// Starts polling the object for dormancy through the bucket update subsystem, FunctionName returns true to keep polling
+	static void StartDormancyPolling(UObject * PollingObject, FName FunctionName);
+
+	// Removes an object added with StartDormancyPolling, call on EndPlay
+	static void StopDormancyPolling(UObject * PollingObject, FName FunctionName);
+
+	// Puts the actor to sleep if it is free to and has been at rest long enough, or wakes it if its physics body woke up while dormant
+	// Returns true if it should keep being polled, which is as long as auto dormancy applies to the actor
+	static bool TryEnterDormancy(AActor * Actor, bool bIsBusy, float LastInteractionTime);
+
+	// TryEnterDormancy for an actor that a grippable or interactibles poll for, it is only free / at rest when the grippable
+	// actor itself and every interactible on it are, so every poller on the same actor comes to the same answer
+	static bool TryEnterOwnerDormancy(AActor * Owner);
+
+	// Multiplier for GetNetPriority, > 1 for a little while after an interaction
+	static float GetNetPriorityScale(const AActor * Actor, float LastInteractionTime);
+
+	static bool IsAutoDormancyEnabled(const AActor * Actor);
+};
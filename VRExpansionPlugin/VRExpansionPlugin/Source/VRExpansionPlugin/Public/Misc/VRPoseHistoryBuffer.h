@@ -0,0 +1,52 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+* Fixed size ring buffer of server side world poses, used to check client authoritative movement against where things
+* actually were at the time the client claims. Memory is bounded by the sample count passed to Record
+* (UVRGlobalSettings::ServerPoseHistoryMaxSamples).
+*/
+struct VREXPANSIONPLUGIN_API FVRPoseHistoryBuffer
+{
+	struct FPoseSample
+	{
+		float   Time    ;
+		FVector Location;
+	};
+
+	FVRPoseHistoryBuffer() :
+		Head(0)
+	{}
+
+	// Adds a sample, overwriting the oldest one once MaxSamples are stored
+	void Record(float Time, const FTransform & Pose, int32 MaxSamples);
+
+	// True if Location is within BaseRadius + Speed * (EndTime - SampleTime) of any sample between StartTime and EndTime,
+	// IE: could something that left this pose at some point in the window have gotten there by EndTime
+	bool IsLocationReachable(const FVector & Location, float StartTime, float EndTime, float BaseRadius, float Speed) const;
+
+	FORCEINLINE int32 Num() const
+	{
+		return Samples.Num();
+	}
+
+	void Reset()
+	{
+		Samples.Reset();
+		Head = 0;
+	}
+
+private:
+
+	// Index 0 is the oldest sample
+	FORCEINLINE const FPoseSample & GetSample(int32 Index) const
+	{
+		return Samples[(Head + Index) % Samples.Num()];
+	}
+
+	TArray<FPoseSample> Samples;
+	int32 Head; // Oldest sample once the buffer has wrapped
+};
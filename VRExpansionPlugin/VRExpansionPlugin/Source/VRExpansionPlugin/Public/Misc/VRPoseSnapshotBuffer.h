@@ -0,0 +1,57 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UWorld;
+struct FBPVRComponentPosRep;
+
+/**
+* Jitter buffer for the replicated relative pose of a tracked component (camera / motion controller) on remote clients.
+* Received poses are time stamped off of a smoothed estimate of the senders interval (arrival times only slowly correct it, so
+* network jitter doesn't end up in the playback) and played back PoseSnapshotInterpolationDelay seconds in the past, so that a
+* late packet still has something to interpolate towards. If the buffer runs dry the pose is extrapolated off of the last
+* two snapshots for at most PoseSnapshotMaxExtrapolationTime. Settings live in UVRGlobalSettings.
+*/
+struct VREXPANSIONPLUGIN_API FVRPoseSnapshotBuffer
+{
+	struct FPoseSnapshot
+	{
+		float    Time    ;
+		FVector  Position;
+		FQuat    Rotation;
+	};
+
+	FVRPoseSnapshotBuffer() :
+		LastArrivalTime      (0.0f ),
+		EstimatedSendInterval(0.0f ),
+		bIsUnderrun          (false)
+	{}
+
+	// Returns false if the buffer is disabled in the global settings or this isn't a client, the caller should fall back to its own smoothing then
+	bool AddSnapshot(const UWorld * World, const FBPVRComponentPosRep & NewPose);
+
+	// Gets the pose to display this frame, returns false if there is nothing buffered
+	bool Sample(const UWorld * World, FVector & OutPosition, FRotator & OutRotation);
+
+	FORCEINLINE bool IsActive() const
+	{
+		return Snapshots.Num() > 0;
+	}
+
+	void Reset()
+	{
+		Snapshots.Reset();
+		LastArrivalTime       = 0.0f;
+		EstimatedSendInterval = 0.0f;
+		bIsUnderrun           = false;
+	}
+
+private:
+
+	TArray<FPoseSnapshot> Snapshots            ;   // Oldest first
+	float                 LastArrivalTime      ;
+	float                 EstimatedSendInterval;   // Smoothed time between received poses
+	bool                  bIsUnderrun          ;
+};
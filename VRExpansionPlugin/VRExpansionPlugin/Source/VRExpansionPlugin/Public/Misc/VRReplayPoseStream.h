@@ -0,0 +1,106 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VRReplayPoseStream.generated.h"
+
+// One sampled set of a characters tracked poses, relative to the character
+struct VREXPANSIONPLUGIN_API FVRReplayPoseSample
+{
+	enum
+	{
+		Pose_Camera          = 0,
+		Pose_LeftController  = 1,
+		Pose_RightController = 2,
+		NumPoses             = 3
+	};
+
+	FVector  Positions[NumPoses];
+	FRotator Rotations[NumPoses];
+};
+
+/**
+* A run of tracked pose samples taken at a fixed rate, only replicated into replays (COND_ReplayOnly).
+* The first sample is a quantized keyframe and every following one is a delta off of the sample before it,
+* so a batch is self contained and a replay checkpoint always has everything it needs to play it back.
+*/
+USTRUCT()
+struct VREXPANSIONPLUGIN_API FVRReplayPoseBatch
+{
+	GENERATED_BODY()
+
+public:
+
+	FVRReplayPoseBatch() :
+		BatchId   (0   ),
+		StartTime (0.0f),
+		SampleRate(30  )
+	{}
+
+	FORCEINLINE float GetEndTime() const
+	{
+		return StartTime + (FMath::Max(Samples.Num() - 1, 0) / (float)FMath::Max<uint8>(SampleRate, 1));
+	}
+
+	// Interpolated sample at Time, clamped to the ends of the batch. Returns false if the batch is empty
+	bool Sample(float Time, FVRReplayPoseSample & OutSample) const;
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+
+	// Samples aren't UPROPERTIES, a new batch is detected off of its id
+	bool Identical(const FVRReplayPoseBatch* Other, uint32 PortFlags) const
+	{
+		return BatchId == Other->BatchId;
+	}
+
+	uint16                       BatchId   ;   // Incremented per batch recorded
+	float                        StartTime ;   // Replay time of the keyframe
+	uint8                        SampleRate;   // Samples per second
+	TArray<FVRReplayPoseSample>  Samples   ;   // [0] is the keyframe
+};
+
+template<>
+struct TStructOpsTypeTraits< FVRReplayPoseBatch > : public TStructOpsTypeTraitsBase2<FVRReplayPoseBatch>
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithIdentical     = true
+	};
+};
+
+/**
+* Records tracked poses into FVRReplayPoseBatch's while a replay is being recorded, and plays received batches back
+* while one is being watched. Settings live in UVRGlobalSettings (bUseReplayPoseStream).
+*/
+struct VREXPANSIONPLUGIN_API FVRReplayPoseStream
+{
+	FVRReplayPoseStream() :
+		NextSampleTime(0.0f),
+		NextBatchId   (0   )
+	{}
+
+	// Adds a sample if one is due, returns true when OutBatch has been filled with a completed batch to replicate
+	bool Record(float ReplayTime, const FVRReplayPoseSample & NewSample, FVRReplayPoseBatch & OutBatch);
+
+	// Playback side, call with each received batch
+	void AddBatch(const FVRReplayPoseBatch & NewBatch);
+
+	// Playback side, interpolated poses at ReplayTime across the received batches
+	bool Sample(float ReplayTime, FVRReplayPoseSample & OutSample) const;
+
+	void Reset()
+	{
+		RecordingBatch.Samples.Reset();
+		PlaybackBatches.Reset();
+		NextSampleTime = 0.0f;
+	}
+
+private:
+
+	FVRReplayPoseBatch         RecordingBatch ;
+	TArray<FVRReplayPoseBatch> PlaybackBatches;   // Oldest first, only the last few are kept
+	float                      NextSampleTime ;
+	uint16                     NextBatchId    ;
+};
@@ -9,6 +9,8 @@
 
 // VREP
 #include "VRBPDatatypes.h"
+#include "Misc/VRPoseSnapshotBuffer.h"
+#include "Misc/VRAdaptiveNetUpdateRate.h"
 
 // UHeader Tool
 #include "ReplicatedVRCameraComponent.generated.h"
@@ -69,7 +71,12 @@ public:
 
 		if (bSmoothReplicatedMotion)
 		{
-			if (bReppedOnce)
+			if (ReplicatedPoseBuffer.AddSnapshot(GetWorld(), ReplicatedCameraTransform))
+			{
+				bLerpingPosition = false;
+				bReppedOnce      = true ;
+			}
+			else if (bReppedOnce)
 			{
 				bLerpingPosition            = true                  ;
 				NetUpdateCount              = 0.0f                  ;
@@ -85,6 +92,7 @@ public:
 		}
 		else
 		{
+			ReplicatedPoseBuffer.Reset();
 			SetRelativeLocationAndRotation(ReplicatedCameraTransform.Position, ReplicatedCameraTransform.Rotation);
 		}
 	}
@@ -107,6 +115,9 @@ public:
 
 	//virtual void PreReplication(IRepChangedPropertyTracker & ChangedPropertyTracker) override;
 
+	// Only used to keep ReplicatedCameraTransform out of replays when the owning character records its replay pose stream
+	virtual void PreReplication(IRepChangedPropertyTracker & ChangedPropertyTracker) override;
+
 
 	// Declares
 
@@ -124,6 +135,15 @@ public:
 	// Used in Tick() to accumulate before sending updates, didn't want to use a timer in this case.
 	float NetUpdateCount;
 
+	FVRAdaptiveNetUpdateRate AdaptiveNetUpdateRate;   // Picks the send rate each tick when bUseAdaptiveNetUpdateRate is on in the global settings
+
+	// Rate the camera is currently sending its transform at, NetUpdateRate unless the adaptive rate is lowering it
+	UFUNCTION(BlueprintPure, Category = "ReplicatedCamera|Networking")
+	float GetEffectiveNetUpdateRate() const
+	{
+		return AdaptiveNetUpdateRate.EffectiveRate > 0.0f ? AdaptiveNetUpdateRate.EffectiveRate : NetUpdateRate;
+	}
+
 	bool bHasAuthority;   /** Whether or not this component has authority within the frame*/
 	bool bIsServer    ;   /** Whether or not this component is currently on the network server*/
 
@@ -133,6 +153,8 @@ public:
 	bool bLerpingPosition;
 	bool bReppedOnce     ;
 
+	FVRPoseSnapshotBuffer ReplicatedPoseBuffer;   // Remote smoothing when the pose snapshot buffer is enabled in the global settings
+
 	FuncPtr_VRBaseChar_TransRPC ServerRPC_SendTransformFunc;   // Crazy bastard.  Original Name: OverrideSendTransform
 
 	//bool IsServer();
@@ -119,8 +119,9 @@ enum class EVRVectorQuantization : uint8
 UENUM()
 enum class EVRRotationQuantization : uint8
 {
-	RoundTo10Bits = 0,   /** Each rotation component will be rounded to 10 bits (1024 values). */
-	RoundToShort  = 1   /** Each rotation component will be rounded to a short. */
+	RoundTo10Bits        = 0,   /** Each rotation component will be rounded to 10 bits (1024 values). */
+	RoundToShort         = 1,   /** Each rotation component will be rounded to a short. */
+	RoundToSmallestThree = 2    /** Sent as a quaternion, the largest component is dropped and the other three are rounded to 11 bits each (35 bits total), no precision loss near gimbal. */
 };
 
 
@@ -243,6 +244,8 @@ public:
 		return (Angle * 360.f / 1024.f);   // map [0->1024) to [0->360)
 	}
 
+	void SerializeSmallestThree(FArchive& Ar);
+
 	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
 
 
@@ -252,7 +255,7 @@ public:
 	UPROPERTY(Transient) FRotator Rotation;
 
 	UPROPERTY(EditDefaultsOnly, Category = Replication, AdvancedDisplay) EVRVectorQuantization   QuantizationLevel        ;   // The quantization level to use for the vector components.
-	UPROPERTY(EditDefaultsOnly, Category = Replication, AdvancedDisplay) EVRRotationQuantization RotationQuantizationLevel;   // The quantization level to use for the rotation components. Using 10 bits mode saves approx 2.25 bytes per replication.
+	UPROPERTY(EditDefaultsOnly, Category = Replication, AdvancedDisplay) EVRRotationQuantization RotationQuantizationLevel;   // The quantization level to use for the rotation components. Using 10 bits mode saves approx 2.25 bytes per replication, smallest three costs 5 bits more than 10 bits mode with better precision.
 };
 
 template<>
@@ -264,6 +267,71 @@ struct TStructOpsTypeTraits< FBPVRComponentPosRep > : public TStructOpsTypeTrait
 	};
 };
 
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\
+
+// FBPVRTrackedPoseFrame ---------------------------------------------------------------------------------------------------\
+
+/*
+The HMD and both controller poses of a character sent to the server in a single RPC with a shared time stamp.
+Only the poses that changed this interval are written, each is flagged with a bit in ValidPoses.
+*/
+USTRUCT()
+struct VREXPANSIONPLUGIN_API FBPVRTrackedPoseFrame
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+
+	// Aliases
+
+	enum EPoseBits : uint8
+	{
+		Pose_Camera          = 1 << 0,
+		Pose_LeftController  = 1 << 1,
+		Pose_RightController = 1 << 2
+	};
+
+
+	// Constructors
+
+	FBPVRTrackedPoseFrame() :
+		TimeStamp (0.0f),
+		ValidPoses(0   )
+	{}
+
+
+	// Functions
+
+	FORCEINLINE bool HasPose(EPoseBits Pose) const { return (ValidPoses & Pose) != 0; }
+	FORCEINLINE bool HasAnyPose()            const { return ValidPoses != 0         ; }
+
+	FORCEINLINE void Reset()
+	{
+		ValidPoses = 0;
+	}
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+
+
+	// Declares
+
+	UPROPERTY(Transient) FBPVRComponentPosRep Camera         ;
+	UPROPERTY(Transient) FBPVRComponentPosRep LeftController ;
+	UPROPERTY(Transient) FBPVRComponentPosRep RightController;
+
+	UPROPERTY(Transient) float TimeStamp ;   // Senders world time when the frame was flushed, shared by all of the poses in it.
+	UPROPERTY(Transient) uint8 ValidPoses;   // EPoseBits
+};
+
+template<>
+struct TStructOpsTypeTraits< FBPVRTrackedPoseFrame > : public TStructOpsTypeTraitsBase2<FBPVRTrackedPoseFrame>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
 //\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\
 
 // FBPInterfaceProperties \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\
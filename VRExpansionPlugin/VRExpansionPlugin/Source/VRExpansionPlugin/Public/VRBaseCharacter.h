@@ -8,6 +8,8 @@
 #include "ReplicatedVRCameraComponent.h"
 #include "ParentRelativeAttachmentComponent.h"
 #include "GripMotionControllerComponent.h"
+#include "Grippables/GrippablePhysicsReplication.h"
+#include "Misc/VRReplayPoseStream.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/Controller.h"
 #include "Components/CapsuleComponent.h"
@@ -162,6 +164,34 @@ struct TStructOpsTypeTraits< FVRReplicatedCapsuleHeight > : public TStructOpsTyp
 	};
 };
 
+/**
+* Sends the characters pending tracked pose frame, it is set to be dependent on the tick of the camera and both
+* controllers so that every pose that came due this frame is staged before the frame goes out.
+*/
+USTRUCT()
+struct VREXPANSIONPLUGIN_API FVRTrackedPoseFrameTickFunction : public FTickFunction
+{
+	GENERATED_USTRUCT_BODY()
+
+	class AVRBaseCharacter * Target;
+
+	FVRTrackedPoseFrameTickFunction() :
+		Target(nullptr)
+	{}
+
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FVRTrackedPoseFrameTickFunction> : public TStructOpsTypeTraitsBase2<FVRTrackedPoseFrameTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
 UCLASS()
 class VREXPANSIONPLUGIN_API AVRBaseCharacter : public ACharacter
 {
@@ -188,8 +218,78 @@ public:
 	UFUNCTION(Unreliable, Server, WithValidation)
 		void Server_SendTransformRightController(FBPVRComponentPosRep NewTransform);
 
+	// Sends the camera and controller poses together in one RPC instead of one per component, the components stage their
+	// poses through StageTrackedPose on their own update rates and the frame is flushed once per tick if anything is pending.
+	// Off by default, each component then sends its own Server_SendTransform RPC as before.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "VRBaseCharacter|Networking")
+		bool bAggregateTrackedPoses;
+
+	UFUNCTION(Unreliable, Server, WithValidation)
+		void Server_SendTrackedPoseFrame(FBPVRTrackedPoseFrame NewFrame);
+
+	// Adds a components pose to the next tracked pose frame, returns false if aggregation is off and the caller should send it itself
+	bool StageTrackedPose(FBPVRTrackedPoseFrame::EPoseBits Pose, const FBPVRComponentPosRep & NewTransform);
+
+	// Sends the pending tracked pose frame if any of the poses were staged
+	void FlushTrackedPoseFrame();
+
+	// Senders time stamp of the last tracked pose frame applied on the server, older frames are dropped
+	UPROPERTY(BlueprintReadOnly, Transient, Category = "VRBaseCharacter|Networking")
+		float LastTrackedPoseFrameTimeStamp;
+
+	FBPVRTrackedPoseFrame PendingTrackedPoseFrame;
+	FVRTrackedPoseFrameTickFunction TrackedPoseFrameTickFunction;
+
+	virtual void RegisterActorTickFunctions(bool bRegister) override;
+	virtual void OnRep_Controller() override;
+
+	// The frame tick is only registered while this is the locally controlled pawn on a client
+	void UpdateTrackedPoseFrameTickRegistration(bool bActorTicksRegistered);
+
+	// Client auth thrown grippables owned by this characters connection queue their movement here instead of each calling
+	// their own Server_GetClientAuthReplication, everything queued during a bucket update goes out in one RPC on the next tick.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "VRBaseCharacter|Networking")
+		bool bBatchClientAuthThrows;
+
+	UFUNCTION(Unreliable, Server, WithValidation)
+		void Server_SendClientAuthThrowBatch(const FVRClientAuthThrowBatch & NewBatch);
+
+	// Queues a thrown actors movement on the character that owns it, returns false if there isn't one (or batching is off)
+	// and the actor should send the movement itself
+	static bool QueueClientAuthThrow(AActor * ThrownActor, const FRepMovementVR & NewMovement);
+
+	// Sends the queued client auth throws
+	void FlushClientAuthThrows();
+
+	// Returns the VR character that owns the actor, either directly through the owner chain or as the pawn of the owning controller
+	static AVRBaseCharacter * FindOwningVRCharacter(const AActor * OwnedActor);
+
+	// Server side check of a client auth thrown actors reported movement when bValidateClientAuthMovement is on in the global settings.
+	// The first update of a throw has to be reachable from one of the owners hands (as recorded in their server pose history) within
+	// the owners ping, later ones can't travel faster than ClientAuthMaxThrowSpeed. Updates that fail should be dropped.
+	static bool ValidateClientAuthMovement(AActor * ThrownActor, FVRClientAuthReplicationData & ReplicationData, const FRepMovementVR & NewMovement);
+
+	FVRClientAuthThrowBatch PendingClientAuthThrows;
+	bool bClientAuthThrowFlushPending;
+	float LastClientAuthThrowBatchTimeStamp;
+
 	virtual void PreReplication(IRepChangedPropertyTracker & ChangedPropertyTracker) override;
 
+	virtual void Tick(float DeltaTime) override;
+
+	// Tracked poses recorded into replays when bUseReplayPoseStream is on, the camera and controllers skip their own
+	// replicated transforms in replays then and are driven from this on playback instead.
+	UPROPERTY(Transient, ReplicatedUsing = OnRep_ReplayPoseBatch)
+		FVRReplayPoseBatch ReplayPoseBatch;
+
+	UFUNCTION()
+		void OnRep_ReplayPoseBatch();
+
+	FVRReplayPoseStream ReplayPoseStream;
+
+	// Records (while a replay is recording) or applies (while one is playing) the tracked poses
+	void TickReplayPoseStream();
+
 	// If true will replicate the capsule height on to clients, allows for dynamic capsule height changes in multiplayer
 	UPROPERTY(EditAnywhere, Replicated, BlueprintReadWrite, Category = "VRBaseCharacter")
 		bool VRReplicateCapsuleHeight;
@@ -11,6 +11,8 @@
 #include "Components/SkeletalMeshComponent.h"
 #include "VRBaseCharacterMovementComponent.generated.h"
 
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("VR Saved Moves Allocated"), STAT_VRSavedMovesAllocated, STATGROUP_Character, VREXPANSIONPLUGIN_API);
+
 /** Delegate for notification when to handle a climbing step up, will override default step up logic if is bound to. */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FVROnPerformClimbingStepUp, FVector, FinalStepUpLocation);
 
@@ -245,6 +247,115 @@ struct TStructOpsTypeTraits< FVRMoveActionArray > : public TStructOpsTypeTraitsB
 };
 
 
+/**
+* Packs a vector quantized to 1/ScaleFactor with one presence bit per axis, zero axes cost nothing past their bit.
+* The present axes share a bit width sized to the largest of them, so small deltas stay small.
+* Returns false if a component had to be clamped to MaxBitsPerComponent.
+*/
+template<int32 ScaleFactor, int32 MaxBitsPerComponent>
+bool SerializeSparsePackedVector(FVector & Vector, FArchive & Ar)
+{
+	static_assert(MaxBitsPerComponent > 1 && MaxBitsPerComponent <= 31, "MaxBitsPerComponent out of range");
+
+	// Largest magnitude that still zigzag encodes into MaxBitsPerComponent
+	const int32 MaxValue = (1 << (MaxBitsPerComponent - 1)) - 1;
+
+	bool bClamped = false;
+	int32 Quantized[3] = { 0, 0, 0 };
+	uint8 PresentAxes = 0;
+	uint32 NumBits = 0;
+
+	if (Ar.IsSaving())
+	{
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			const int32 Value = FMath::RoundToInt(Vector[Axis] * ScaleFactor);
+			Quantized[Axis] = FMath::Clamp(Value, -MaxValue, MaxValue);
+			bClamped |= Quantized[Axis] != Value;
+
+			if (Quantized[Axis] != 0)
+			{
+				PresentAxes |= (1 << Axis);
+
+				const uint32 ZigZag = (uint32)((Quantized[Axis] << 1) ^ (Quantized[Axis] >> 31));
+				NumBits = FMath::Max(NumBits, FMath::FloorLog2(ZigZag) + 1);
+			}
+		}
+	}
+
+	Ar.SerializeBits(&PresentAxes, 3);
+
+	if (PresentAxes != 0)
+	{
+		// Stored as NumBits - 1, 5 bits covers 1 - 32
+		uint32 NumBitsMinusOne = NumBits > 0 ? NumBits - 1 : 0;
+		Ar.SerializeBits(&NumBitsMinusOne, 5);
+		NumBits = FMath::Min<uint32>(NumBitsMinusOne + 1, MaxBitsPerComponent);
+
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			if (!(PresentAxes & (1 << Axis)))
+				continue;
+
+			uint32 ZigZag = Ar.IsSaving() ? (uint32)((Quantized[Axis] << 1) ^ (Quantized[Axis] >> 31)) : 0;
+			Ar.SerializeBits(&ZigZag, NumBits);
+
+			if (Ar.IsLoading())
+				Quantized[Axis] = (int32)(ZigZag >> 1) ^ -(int32)(ZigZag & 1);
+		}
+	}
+
+	if (Ar.IsLoading())
+	{
+		// Divided per axis the same way ReadPackedVector does, so both decode to bit identical values
+		Vector = FVector((float)Quantized[0] / ScaleFactor, (float)Quantized[1] / ScaleFactor, (float)Quantized[2] / ScaleFactor);
+	}
+
+	return !bClamped && !Ar.IsError();
+}
+
+/**
+* FVector_NetQuantize100 precision for mostly small / sparse vectors (frame deltas, HMD relative offsets), see SerializeSparsePackedVector.
+* A zero vector costs 3 bits instead of the ~8 of FVector_NetQuantize100.
+*/
+USTRUCT()
+struct VREXPANSIONPLUGIN_API FVector_NetQuantizeSparse100 : public FVector
+{
+	GENERATED_USTRUCT_BODY()
+
+	FORCEINLINE FVector_NetQuantizeSparse100()
+	{}
+
+	explicit FORCEINLINE FVector_NetQuantizeSparse100(EForceInit E)
+		: FVector(E)
+	{}
+
+	FORCEINLINE FVector_NetQuantizeSparse100(float InX, float InY, float InZ)
+		: FVector(InX, InY, InZ)
+	{}
+
+	FORCEINLINE FVector_NetQuantizeSparse100(const FVector &InVec)
+	{
+		FVector::operator=(InVec);
+	}
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+	{
+		bOutSuccess = SerializeSparsePackedVector<100, 30>(*this, Ar);
+		return true;
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits< FVector_NetQuantizeSparse100 > : public TStructOpsTypeTraitsBase2<FVector_NetQuantizeSparse100>
+{
+	enum
+	{
+		WithNetSerializer          = true,
+		WithNetSharedSerialization = true
+	};
+};
+
 USTRUCT()
 struct VREXPANSIONPLUGIN_API FVRConditionalMoveRep
 {
@@ -284,11 +395,12 @@ public:
 			Ar.SerializeBits(&bHasRequestedVelocity, 1);
 			//Ar.SerializeBits(&bHasMoveAction, 1);
 
+			// Sparse packing, these are usually planar so Z drops out
 			if (bHasVRinput)
-				bOutSuccess &= SerializePackedVector<100, 22/*30*/>(CustomVRInputVector, Ar);
+				bOutSuccess &= SerializeSparsePackedVector<100, 22/*30*/>(CustomVRInputVector, Ar);
 
 			if (bHasRequestedVelocity)
-				bOutSuccess &= SerializePackedVector<100, 22/*30*/>(RequestedVelocity, Ar);
+				bOutSuccess &= SerializeSparsePackedVector<100, 22/*30*/>(RequestedVelocity, Ar);
 
 			//if (bHasMoveAction)
 			MoveActionArray.NetSerialize(Ar, Map, bOutSuccess);
@@ -510,13 +622,28 @@ public:
 		if (!FMath::IsNearlyEqual(LFDiff.Z, nMove->LFDiff.Z))
 			return false;
 
-		if (!LFDiff.IsZero() && !nMove->LFDiff.IsZero() && !FVector::Coincident(LFDiff.GetSafeNormal2D(), nMove->LFDiff.GetSafeNormal2D(), AccelDotThresholdCombine))
+		// HMD only moves are summed regardless of direction, up to the movement components HMDOnlyMoveCombineWindow
+		if (!LFDiff.IsZero() && !nMove->LFDiff.IsZero() && !FVector::Coincident(LFDiff.GetSafeNormal2D(), nMove->LFDiff.GetSafeNormal2D(), AccelDotThresholdCombine) && !CanCombineHMDOnlyMoves(nMove, Character))
 			return false;
 
 		return FSavedMove_Character::CanCombineWith(NewMove, Character, MaxDelta);
 	}
 
 
+	// True if this move only carries HMD relative movement while at rest, no locomotion input, move actions or custom movement
+	bool IsHMDOnlyMove() const
+	{
+		return Acceleration.IsZero()                                             &&
+			   StartVelocity.IsNearlyZero()                                      &&
+			   !bPressedJump                                                     &&
+			   VRReplicatedMovementMode == EVRConjoinedMovementModes::C_MOVE_MAX &&
+			   ConditionalValues.MoveActionArray.MoveActions.Num() < 1           &&
+			   ConditionalValues.CustomVRInputVector.IsZero()                    &&
+			   ConditionalValues.RequestedVelocity.IsZero();
+	}
+
+	bool CanCombineHMDOnlyMoves(const FSavedMove_VRBaseCharacter * NewMove, ACharacter * Character) const;
+
 	virtual bool IsImportantMove(const FSavedMovePtr& LastAckedMove) const override
 	{
 		// Auto important if toggled climbing
@@ -548,6 +675,28 @@ public:
 	virtual void PostUpdate(ACharacter* C, EPostUpdateMode PostUpdateMode) override;
 };
 
+// Shared client prediction data for the VR characters
+class VREXPANSIONPLUGIN_API FNetworkPredictionData_Client_VRBaseCharacter : public FNetworkPredictionData_Client_Character
+{
+public:
+	FNetworkPredictionData_Client_VRBaseCharacter(const UCharacterMovementComponent& ClientMovement)
+		: FNetworkPredictionData_Client_Character(ClientMovement),
+		bHasPreallocatedSavedMoves(false)
+	{}
+
+	/*
+	Fills the free move list with enough moves for a full SavedMoves list (plus the pending and last acked move)
+	and lets every freed move back into it, so move list growth under high ping never allocates.
+	Called on the first ReplicateMoveToServer so that simulated proxies and listen servers, which also create
+	client prediction data, never pay for it. See UVRGlobalSettings::bPreallocateClientSavedMoves.
+	*/
+	void PreallocateSavedMoves();
+
+private:
+
+	bool bHasPreallocatedSavedMoves;
+};
+
 // Using this fixes the problem where the character capsule isn't reset after a scoped movement update revert (pretty much just in StepUp operations)
 class VREXPANSIONPLUGIN_API FVRCharacterScopedMovementUpdate : public FScopedMovementUpdate
 {
@@ -730,6 +879,11 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRMovement")
 		bool bRunControlRotationInMovementComponent;
 
+	// If above zero, client moves that only carry HMD movement while standing still are held and combined into one move
+	// for up to this long (seconds, capped by MaxMoveDeltaTime). Locomotion input, move actions and mode changes still send right away.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRMovement|Networking", meta = (ClampMin = "0.0", UIMin = "0", ClampMax = "0.2", UIMax = "0.2"))
+		float HMDOnlyMoveCombineWindow;
+
 	// Moved into compute floor dist
 	// Option to Skip simulating components when looking for floor
 	/*virtual bool FloorSweepTest(
@@ -528,6 +528,46 @@ public:
 	UPROPERTY(config, EditAnywhere, Category = "GunSettings|Secondary Grip 1Euro Settings") float OneEuroCutoffSlope;   // Setting to use for the OneEuro smoothing low pass filter when double gripping something held with a hand.
 	UPROPERTY(config, EditAnywhere, Category = "GunSettings|Secondary Grip 1Euro Settings") float OneEuroDeltaCutoff;   // Setting to use for the OneEuro smoothing low pass filter when double gripping something held with a hand.
 
+	UPROPERTY(config, EditAnywhere, Category = "PhysicsGrips", meta = (ClampMin = "0")) int32 MaxPooledPhysicsHandles;   // Max released physics grip handles (kinematic actor + joint) kept per physics scene for re-use, 0 disables pooling.
+
+	UPROPERTY(config, EditAnywhere, Category = "GripLOD"                                ) bool  bUseGripLOD           ;   // Lowers the update rate of grips simulated for other players (server / simulated proxies) that are far from every viewpoint or not rendered recently.
+	UPROPERTY(config, EditAnywhere, Category = "GripLOD", meta = (ClampMin = "0")) float GripLODDistance       ;   // Distance (cm) from the hand to the closest player viewpoint past which its grips are reduced, 0 disables the distance check.
+	UPROPERTY(config, EditAnywhere, Category = "GripLOD", meta = (ClampMin = "0")) float GripLODNotRenderedTime;   // Seconds a gripped object has to go unrendered before its grip is reduced, 0 disables the check. Not used on dedicated servers.
+	UPROPERTY(config, EditAnywhere, Category = "GripLOD", meta = (ClampMin = "1")) float GripLODUpdateRate     ;   // Full updates per second for reduced grips, between them the object is carried along with the hand without sweeps or scripts.
+
+	UPROPERTY(config, EditAnywhere, Category = "ReplicatedPoses"                                ) bool  bUsePoseSnapshotBuffer          ;   // Replicated camera / controller poses with bSmoothReplicatedMotion on are played back from a jitter buffer instead of lerping towards the newest pose.
+	UPROPERTY(config, EditAnywhere, Category = "ReplicatedPoses", meta = (ClampMin = "2")) int32 PoseSnapshotBufferSize          ;   // Upper bound on poses kept per component, needs to cover InterpolationDelay * the senders net update rate (plus margin).
+	UPROPERTY(config, EditAnywhere, Category = "ReplicatedPoses", meta = (ClampMin = "0")) float PoseSnapshotInterpolationDelay  ;   // Seconds behind the newest received pose that playback runs at, should cover the expected packet jitter.
+	UPROPERTY(config, EditAnywhere, Category = "ReplicatedPoses", meta = (ClampMin = "0")) float PoseSnapshotMaxExtrapolationTime;   // Max seconds to extrapolate past the newest pose when the buffer runs dry, after that the pose holds.
+
+	UPROPERTY(config, EditAnywhere, Category = "ReplicatedPoses|AdaptiveRate"                                    ) bool  bUseAdaptiveNetUpdateRate          ;   // Locally tracked cameras / controllers scale their send rate between AdaptiveNetUpdateMinRate and their own NetUpdateRate by how fast they are moving.
+	UPROPERTY(config, EditAnywhere, Category = "ReplicatedPoses|AdaptiveRate", meta = (ClampMin = "1"  )) float AdaptiveNetUpdateMinRate           ;   // Send rate (htz) for a component that is nearly still.
+	UPROPERTY(config, EditAnywhere, Category = "ReplicatedPoses|AdaptiveRate", meta = (ClampMin = "0"  )) float AdaptiveNetUpdateLinearVelocity    ;   // Linear velocity (cm/s) at and above which the full rate is used.
+	UPROPERTY(config, EditAnywhere, Category = "ReplicatedPoses|AdaptiveRate", meta = (ClampMin = "0"  )) float AdaptiveNetUpdateAngularVelocity   ;   // Angular velocity (deg/s) at and above which the full rate is used.
+	UPROPERTY(config, EditAnywhere, Category = "ReplicatedPoses|AdaptiveRate", meta = (ClampMin = "0", ClampMax = "1")) float AdaptiveNetUpdateBandwidthFraction;   // Share of the connections net speed the characters three tracked poses may use combined, 0 disables the cap.
+
+	UPROPERTY(config, EditAnywhere, Category = "ClientAuthValidation"                                ) bool  bValidateClientAuthMovement  ;   // Server records a short pose history of remote players controllers and rejects client auth throws that couldn't have come from their hands or move too fast.
+	UPROPERTY(config, EditAnywhere, Category = "ClientAuthValidation", meta = (ClampMin = "2")) int32 ServerPoseHistoryMaxSamples  ;   // Samples kept per controller (one per server tick), bounds the memory used by the history.
+	UPROPERTY(config, EditAnywhere, Category = "ClientAuthValidation", meta = (ClampMin = "0")) float ServerPoseHistoryLength      ;   // Max seconds into the past a client auth update is checked against, on top of the owners ping.
+	UPROPERTY(config, EditAnywhere, Category = "ClientAuthValidation", meta = (ClampMin = "0")) float ClientAuthMaxThrowSpeed      ;   // Max speed (cm/s) a client auth thrown object is allowed to report or travel at.
+	UPROPERTY(config, EditAnywhere, Category = "ClientAuthValidation", meta = (ClampMin = "0")) float ClientAuthMaxReleaseDistance ;   // Max distance (cm) from a hand that a thrown object can start at.
+
+	UPROPERTY(config, EditAnywhere, Category = "PhysicsReplication", meta = (ClampMin = "0")) int32 PhysicsReplicationMaxTargetsPerTick  ;   // Max client auth physics targets the server applies per tick, the rest wait for their turn (round robin). 0 is unlimited.
+	UPROPERTY(config, EditAnywhere, Category = "PhysicsReplication", meta = (ClampMin = "0")) float PhysicsReplicationMaxTickTimeMs      ;   // Max milliseconds per tick spent applying client auth physics targets, at least one is always applied. 0 is unlimited.
+	UPROPERTY(config, EditAnywhere, Category = "PhysicsReplication", meta = (ClampMin = "0")) float PhysicsReplicationMaxPingCompensation;   // Max seconds that targets are extrapolated forward by to make up for the owners one way latency.
+
+	UPROPERTY(config, EditAnywhere, Category = "NetDormancy"                                ) bool  bUseAutoNetDormancy           ;   // Grippable actors and interactibles go net dormant when not held and at rest, and wake on grip / interaction.
+	UPROPERTY(config, EditAnywhere, Category = "NetDormancy", meta = (ClampMin = "1")) int32 AutoDormancyCheckRate         ;   // How often (htz) free objects are checked for going dormant.
+	UPROPERTY(config, EditAnywhere, Category = "NetDormancy", meta = (ClampMin = "0")) float AutoDormancyRestTime          ;   // Seconds after the last interaction before an object at rest may go dormant.
+	UPROPERTY(config, EditAnywhere, Category = "NetDormancy", meta = (ClampMin = "0")) float RecentInteractionPriorityTime ;   // Seconds after an interaction that a grippable actors net priority is boosted, 0 disables the boost.
+	UPROPERTY(config, EditAnywhere, Category = "NetDormancy", meta = (ClampMin = "1")) float RecentInteractionPriorityScale;   // Net priority multiplier for recently touched grippable actors.
+
+	UPROPERTY(config, EditAnywhere, Category = "Replays"                                  ) bool  bUseReplayPoseStream ;   // VR characters record their tracked poses into replays as compact keyframe + delta batches, instead of the per component replicated transforms.
+	UPROPERTY(config, EditAnywhere, Category = "Replays", meta = (ClampMin = "1", ClampMax = "255")) int32 ReplayPoseSampleRate ;   // Tracked pose samples per second recorded into replays.
+	UPROPERTY(config, EditAnywhere, Category = "Replays", meta = (ClampMin = "0.05")) float ReplayPoseBatchLength;   // Seconds of samples per recorded batch (one keyframe each), playback runs this far behind the replay time.
+
+	UPROPERTY(config, EditAnywhere, Category = "CharacterMovement") bool bPreallocateClientSavedMoves;   // Locally controlled VR characters allocate their full saved move pool up front (sized from MaxSavedMoveCount) so high ping move list growth never allocates.
+
 	/** Delegate for notification when the controller profile changes. */
 	DECLARE_MULTICAST_DELEGATE(FVRControllerProfileChangedEvent); 
 	FVRControllerProfileChangedEvent OnControllerProfileChangedEvent;
@@ -119,6 +119,13 @@ public:
 
 	bool BCalledUpdateTransform;   // Original Name: bCalledUpdateTransform
 
+	FBox  SweepBroadphaseBounds       ;   // Region last checked for blockers, invalid when it needs a refresh
+	float SweepBroadphaseRefreshTime  ;
+	bool  BSweepBroadphaseHasBlockers ;
+
+	FBox                 OverlapCandidateBounds ;   // Region OverlapCandidates was gathered for, invalid when it needs a refresh
+	TArray<FOverlapInfo> OverlapCandidates      ;
+
 	AVRBaseCharacter* OwningVRChar           ;   // Original Name: owningVRChar
 	FVector           DifferenceFromLastFrame;
 	FTransform        OffsetComponentToWorld ;
@@ -148,6 +155,25 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRExpansionLibrary") bool                           BUseWalkingCollisionOverride;   // Original Name: bUseWalkingCollisionOverride
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRExpansionLibrary") TEnumAsByte<ECollisionChannel> WalkingCollisionOverride    ;
 
+	/*
+	Only run the relative movement sweep when something blocking on the walking collision channel is within
+	SweepBroadphaseInflation of the capsule horizontally. The floor the capsule is walking on is not counted.
+	The nearby blockers are re-checked at SweepBroadphaseRefreshRate (Hz) or as soon as the capsule leaves the checked region.
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRExpansionLibrary") bool                           BUseSweepBroadphaseCache    ;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRExpansionLibrary") float                          SweepBroadphaseInflation    ;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRExpansionLibrary") float                          SweepBroadphaseRefreshRate  ;
+
+	/*
+	Gather overlap candidates within IncrementalOverlapInflation of the capsule once and only test those (and current overlaps)
+	while the capsule stays inside that region, instead of a full overlap query every time the offset capsule moves.
+	Every candidate costs a narrowphase test, so with more than IncrementalOverlapMaxTests of them (0 for no limit)
+	the single full query is used instead.
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRExpansionLibrary") bool                           BUseIncrementalOverlaps     ;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRExpansionLibrary") float                          IncrementalOverlapInflation ;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRExpansionLibrary") int32                          IncrementalOverlapMaxTests  ;
+
 	// If valid will use this as the tracked parent instead of the HMD / Parent.
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRTrackedParentInterface")
 		FBPVRWaistTracking_Info OptionalWaistTrackingParent;
@@ -181,6 +207,12 @@ protected:
 
 	void SendPhysicsTransform(ETeleportType Teleport);
 
+	// False if nothing that could block a sweep from Start to End is near the capsule, see BUseSweepBroadphaseCache
+	bool SweepBroadphaseMayBlock(const FVector & Start, const FVector & End, const FCollisionQueryParams & Params, const FCollisionResponseParams & ResponseParam);
+
+	// Tests the cached overlap candidates (see BUseIncrementalOverlaps), returns false if a full overlap query is needed instead
+	bool GatherIncrementalOverlaps(TArray<FOverlapInfo, TInlineAllocator<3>>& OutOverlaps, bool bIgnoreChildren);
+
 	virtual bool UpdateOverlapsImpl
 	(
 		const TArray<FOverlapInfo>* NewPendingOverlaps    = nullptr,